@@ -1,38 +1,113 @@
 #ifndef ERD_ADDRESS_H
 #define ERD_ADDRESS_H
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <functional>
 #include <string>
+#include <vector>
 #include "internal/internal.h"
 
 class Address
 {
-    std::string const hrp = "erd";
+public:
+    // Fixed-size public key. Converts implicitly to bytes and compares with bytes, for callers that take bytes.
+    struct PublicKey : std::array<uint8_t, PUBLIC_KEY_LENGTH>
+    {
+        operator bytes() const
+        {
+            return bytes(begin(), end());
+        }
 
-    int const kNoBitsInByte = 8;
-    int const kNoBitsInBech32 = 5;
+        friend bool operator==(PublicKey const &lhs, PublicKey const &rhs)
+        {
+            return static_cast<std::array<uint8_t, PUBLIC_KEY_LENGTH> const &>(lhs) ==
+                   static_cast<std::array<uint8_t, PUBLIC_KEY_LENGTH> const &>(rhs);
+        }
 
-public:
+        friend bool operator==(PublicKey const &lhs, bytes const &rhs)
+        {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        friend bool operator==(bytes const &lhs, PublicKey const &rhs)
+        {
+            return rhs == lhs;
+        }
+
+        friend bool operator!=(PublicKey const &lhs, bytes const &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator!=(bytes const &lhs, PublicKey const &rhs)
+        {
+            return !(rhs == lhs);
+        }
+    };
 
     explicit Address(bytes const &publicKey);
 
+    explicit Address(PublicKey const &publicKey);
+
     explicit Address(std::string const &bech32Address);
 
+    Address(Address const &other);
+
+    Address(Address &&other) noexcept;
+
     Address& operator=(Address const& rhs);
 
+    Address& operator=(Address &&rhs) noexcept;
+
+    ~Address();
+
     bool operator==(const Address &address) const;
 
-    bytes getPublicKey() const;
+    bool operator!=(const Address &address) const;
 
-    std::string getBech32Address() const;
+    PublicKey const &getPublicKey() const;
+
+    // Encoded on first call and cached afterwards. Safe to call concurrently on the same address.
+    std::string const &getBech32Address() const;
+
+    // Bulk conversions, e.g. for address lists loaded from files. Throws on the first invalid bech32 address.
+    static std::vector<Address> fromBech32(std::vector<std::string> const &bech32Addresses);
+
+    static std::vector<std::string> toBech32(std::vector<Address> const &addresses);
 
 private:
 
     std::string computeBech32Address() const;
 
-    bytes computePkFromBech32() const;
+    PublicKey m_pk;
+    mutable std::atomic<std::string const *> m_bech32Address;
+};
 
-    bytes m_pk;
-    std::string m_bech32Address;
+namespace std
+{
+template<>
+struct hash<Address::PublicKey>
+{
+    // Public keys are uniformly distributed, so their leading bytes are already a good hash
+    std::size_t operator()(Address::PublicKey const &publicKey) const noexcept
+    {
+        std::size_t hash;
+        std::memcpy(&hash, publicKey.data(), sizeof(hash));
+        return hash;
+    }
+};
+
+template<>
+struct hash<Address>
+{
+    std::size_t operator()(Address const &address) const noexcept
+    {
+        return hash<Address::PublicKey>()(address.getPublicKey());
+    }
 };
+}
 
 #endif //ERD_ADDRESS_H
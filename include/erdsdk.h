@@ -3,9 +3,11 @@
 
 #include "internal/internal.h"
 #include "internal/biguint.h"
+#include "internal/optional.h"
 #include "transaction/signer.h"
 #include "transaction/messagesigner.h"
 #include "transaction/transaction.h"
+#include "transaction/keyring.h"
 #include "transaction/esdt.h"
 #include "transaction/gas_estimator.h"
 #include "transaction/token_payment.h"
@@ -17,7 +19,13 @@
 #include "account/address.h"
 #include "filehandler/isecretkey.h"
 #include "filehandler/pemreader.h"
+#include "filehandler/pembundle.h"
 #include "filehandler/keyfilereader.h"
+#include "filehandler/keyfileloader.h"
 #include "provider/proxyprovider.h"
+#include "provider/async_proxyprovider.h"
+#include "provider/transaction_watcher.h"
+#include "provider/nonce_manager.h"
+#include "provider/bulk_fetcher.h"
 
 #endif //ERD_SDK_H
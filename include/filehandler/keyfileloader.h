@@ -0,0 +1,86 @@
+#ifndef KEY_FILE_LOADER_H
+#define KEY_FILE_LOADER_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "keyfilereader.h"
+
+// Unlocked secret keys of key files, so that unlocking a file again skips the expensive key derivation.
+// Entries are keyed by file path, and are only used if the file was not modified since (same modification time,
+// size and inode) and for the same password. Secret keys and password hashes are kept in memory that is locked,
+// so never swapped to disk, and zeroed when freed. This only holds for the cache's own copies: a KeyFileReader keeps
+// its secret key in ordinary memory, zeroed when the reader is destroyed. Safe to use from multiple threads.
+class KeyFileCache
+{
+public:
+    KeyFileCache();
+
+    ~KeyFileCache();
+
+    KeyFileCache(KeyFileCache const &) = delete;
+
+    KeyFileCache &operator=(KeyFileCache const &) = delete;
+
+    std::size_t size() const;
+
+    void clear();
+
+private:
+    friend class KeyFileReader;
+
+    struct Stamp
+    {
+        int64_t modificationTime;
+        int64_t modificationTimeNs;
+        int64_t size;
+        uint64_t inode;
+
+        bool operator==(Stamp const &other) const;
+    };
+
+    struct Entry;
+
+    // Throws if the file can not be accessed
+    static Stamp stampOf(std::string const &filePath);
+
+    bool find(std::string const &filePath, Stamp const &stamp, std::string const &password, bytes &secretKey) const;
+
+    void insert(std::string const &filePath, Stamp const &stamp, std::string const &password, bytes const &secretKey);
+
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+};
+
+struct KeyFileCredentials
+{
+    std::string filePath;
+    std::string password;
+};
+
+// Outcome of loading one key file: the unlocked file, or the reason it could not be unlocked
+struct KeyFileLoadResult
+{
+    std::unique_ptr<KeyFileReader> keyFile;
+    std::string error;
+};
+
+// Unlocks many key files at once, on numThreads threads (0 for one per core). Each key derivation runs on a
+// single core, so loading hundreds of files at startup scales with the number of cores.
+class KeyFileLoader
+{
+public:
+    explicit KeyFileLoader(unsigned int numThreads = 0, std::shared_ptr<KeyFileCache> cache = nullptr);
+
+    // Returns one result per file, in the same order. Failures are reported per file instead of thrown.
+    std::vector<KeyFileLoadResult> load(std::vector<KeyFileCredentials> const &files) const;
+
+private:
+    unsigned int m_numThreads;
+    std::shared_ptr<KeyFileCache> m_cache;
+};
+
+#endif
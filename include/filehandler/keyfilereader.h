@@ -9,11 +9,20 @@
 #include "account/address.h"
 #include "internal/internal.h"
 
+class KeyFileCache;
+
 class KeyFileReader : protected IFile, public ISecretKey
 {
 public:
     explicit KeyFileReader(std::string const &filePath, std::string const &password);
 
+    // Takes the secret key from the cache if this file was already unlocked with this password and not modified since.
+    // Otherwise decrypts the file and adds its secret key to the cache.
+    KeyFileReader(std::string const &filePath, std::string const &password, KeyFileCache &cache);
+
+    // Zeroes the secret key
+    ~KeyFileReader();
+
     Address getAddress() const override;
 
     bytes getSeed() const override;
@@ -21,6 +30,8 @@ public:
 private:
     EncryptedData getFileContent() const;
 
+    bytes decryptSecretKey(std::string const &password) const;
+
     bytes m_secretKey;
 };
 
@@ -1,14 +1,31 @@
 #ifndef ERD_BIG_UINT_H
 #define ERD_BIG_UINT_H
 
+#include <array>
+#include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
+
+// Number of 64 bit limbs stored without heap allocation (256 bits)
+#define BIG_UINT_INLINE_LIMBS 4U
 
 class BigUInt
 {
 public:
     explicit BigUInt(uint64_t value);
 
-    explicit BigUInt(std::string value);
+    explicit BigUInt(std::string const &value);
+
+    BigUInt(BigUInt const &other) = default;
+
+    // Leaves other equal to zero
+    BigUInt(BigUInt &&other) noexcept;
+
+    BigUInt &operator=(BigUInt const &rhs) = default;
+
+    // Leaves rhs equal to zero
+    BigUInt &operator=(BigUInt &&rhs) noexcept;
 
     BigUInt operator*(BigUInt const &rhs) const;
 
@@ -16,6 +33,8 @@ public:
 
     bool operator==(BigUInt const &rhs) const;
 
+    bool operator!=(BigUInt const &rhs) const;
+
     bool operator>(BigUInt const &rhs) const;
 
     bool operator<(BigUInt const &rhs) const;
@@ -24,14 +43,72 @@ public:
 
     BigUInt operator+(BigUInt const &rhs) const;
 
+    BigUInt &operator+=(BigUInt const &rhs);
+
+    BigUInt &operator-=(BigUInt const &rhs);
+
+    BigUInt &operator*=(BigUInt const &rhs);
+
+    BigUInt &operator/=(BigUInt const &rhs);
+
+    // Adds projection(element) for each element in [first, last) to this value, in place
+    template<typename Iterator, typename Projection>
+    BigUInt &accumulate(Iterator first, Iterator last, Projection projection)
+    {
+        for (; first != last; ++first)
+        {
+            *this += projection(*first);
+        }
+        return *this;
+    }
+
+    template<typename Iterator>
+    static BigUInt sum(Iterator first, Iterator last)
+    {
+        BigUInt result(0);
+        for (; first != last; ++first)
+        {
+            result += *first;
+        }
+        return result;
+    }
+
+    // E.g. BigUInt::sum(accounts.begin(), accounts.end(), [](Account const &account) { return account.getBalance(); })
+    template<typename Iterator, typename Projection>
+    static BigUInt sum(Iterator first, Iterator last, Projection projection)
+    {
+        BigUInt result(0);
+        result.accumulate(first, last, projection);
+        return result;
+    }
+
     std::pair<BigUInt, BigUInt> divmod(BigUInt const &rhs) const;
 
     std::string getHexValue() const;
 
-    const std::string &getValue() const;
+    // Decimal representation, computed on each call
+    std::string getValue() const;
 
 private:
-    std::string m_value;
+    BigUInt();
+
+    uint64_t const *limbs() const;
+
+    uint64_t *limbs();
+
+    // Changes the number of limbs, zero filling new ones and moving between inline and heap storage if needed
+    void resize(std::size_t size);
+
+    // Drops leading zero limbs
+    void trim();
+
+    int compare(BigUInt const &rhs) const;
+
+    // Little endian 64 bit limbs, without leading zero limbs (zero has no limbs).
+    // Values up to BIG_UINT_INLINE_LIMBS limbs live in m_inline, larger ones in m_heap.
+    std::size_t m_size;
+    std::array<uint64_t, BIG_UINT_INLINE_LIMBS> m_inline;
+    std::vector<uint64_t> m_heap;
 };
 
 #endif //ERD_BIG_UINT_H
@@ -5,6 +5,11 @@
 #include <vector>
 #include <cstdint>
 
+#define PUBLIC_KEY_LENGTH 32U
+#define SECRET_KEY_LENGTH 64U
+#define SEED_LENGTH 32U
+#define SIGNATURE_LENGTH 64U
+
 #define KEY_FILE_VERSION 4U
 #define KEY_FILE_DERIVATION_FUNCTION std::string("scrypt")
 #define KEY_FILE_CIPHER_ALGORITHM std::string("aes-128-ctr")
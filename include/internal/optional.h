@@ -0,0 +1,221 @@
+#ifndef ERD_OPTIONAL_H
+#define ERD_OPTIONAL_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Value or nothing, stored inline: a C++14 stand-in for std::optional, for optional members of value types.
+// An empty Optional compares equal to nullptr and can be reset by assigning nullptr, so that it reads like the
+// shared_ptr it replaces. It can also be assigned from a shared_ptr, whose value (if any) is copied.
+template<typename T>
+class Optional
+{
+public:
+    Optional() noexcept :
+            m_hasValue(false)
+    {}
+
+    Optional(std::nullptr_t) noexcept :
+            m_hasValue(false)
+    {}
+
+    Optional(T const &value) :
+            m_hasValue(false)
+    {
+        emplace(value);
+    }
+
+    Optional(T &&value) :
+            m_hasValue(false)
+    {
+        emplace(std::move(value));
+    }
+
+    Optional(std::shared_ptr<T> const &value) :
+            m_hasValue(false)
+    {
+        if (value != nullptr)
+        {
+            emplace(*value);
+        }
+    }
+
+    Optional(Optional const &other) :
+            m_hasValue(false)
+    {
+        if (other.m_hasValue)
+        {
+            emplace(*other);
+        }
+    }
+
+    Optional(Optional &&other) noexcept(std::is_nothrow_move_constructible<T>::value) :
+            m_hasValue(false)
+    {
+        if (other.m_hasValue)
+        {
+            emplace(std::move(*other));
+        }
+    }
+
+    ~Optional()
+    {
+        reset();
+    }
+
+    // Assigning onto an existing value reuses it, e.g. the capacity of a string or vector
+    Optional &operator=(Optional const &other)
+    {
+        if (!other.m_hasValue)
+        {
+            reset();
+        }
+        else if (m_hasValue)
+        {
+            **this = *other;
+        }
+        else
+        {
+            emplace(*other);
+        }
+        return *this;
+    }
+
+    Optional &operator=(Optional &&other) noexcept(std::is_nothrow_move_constructible<T>::value &&
+                                                   std::is_nothrow_move_assignable<T>::value)
+    {
+        if (!other.m_hasValue)
+        {
+            reset();
+        }
+        else if (m_hasValue)
+        {
+            **this = std::move(*other);
+        }
+        else
+        {
+            emplace(std::move(*other));
+        }
+        return *this;
+    }
+
+    Optional &operator=(T const &value)
+    {
+        if (m_hasValue)
+        {
+            **this = value;
+        }
+        else
+        {
+            emplace(value);
+        }
+        return *this;
+    }
+
+    Optional &operator=(T &&value)
+    {
+        if (m_hasValue)
+        {
+            **this = std::move(value);
+        }
+        else
+        {
+            emplace(std::move(value));
+        }
+        return *this;
+    }
+
+    Optional &operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    template<typename... Args>
+    T &emplace(Args &&... args)
+    {
+        reset();
+        ::new(static_cast<void *>(&m_storage)) T(std::forward<Args>(args)...);
+        m_hasValue = true;
+        return **this;
+    }
+
+    void reset() noexcept
+    {
+        if (m_hasValue)
+        {
+            (**this).~T();
+            m_hasValue = false;
+        }
+    }
+
+    bool hasValue() const noexcept
+    {
+        return m_hasValue;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return m_hasValue;
+    }
+
+    T &operator*() noexcept
+    {
+        return *reinterpret_cast<T *>(&m_storage);
+    }
+
+    T const &operator*() const noexcept
+    {
+        return *reinterpret_cast<T const *>(&m_storage);
+    }
+
+    T *operator->() noexcept
+    {
+        return &**this;
+    }
+
+    T const *operator->() const noexcept
+    {
+        return &**this;
+    }
+
+    // Both empty, or both holding equal values
+    bool operator==(Optional const &rhs) const
+    {
+        return (m_hasValue == rhs.m_hasValue) && (!m_hasValue || **this == *rhs);
+    }
+
+    bool operator!=(Optional const &rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    friend bool operator==(Optional const &optional, std::nullptr_t) noexcept
+    {
+        return !optional.m_hasValue;
+    }
+
+    friend bool operator==(std::nullptr_t, Optional const &optional) noexcept
+    {
+        return !optional.m_hasValue;
+    }
+
+    friend bool operator!=(Optional const &optional, std::nullptr_t) noexcept
+    {
+        return optional.m_hasValue;
+    }
+
+    friend bool operator!=(std::nullptr_t, Optional const &optional) noexcept
+    {
+        return optional.m_hasValue;
+    }
+
+private:
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type m_storage;
+    bool m_hasValue;
+};
+
+#endif //ERD_OPTIONAL_H
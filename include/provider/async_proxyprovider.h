@@ -0,0 +1,70 @@
+#ifndef ERD_ASYNC_PROXY_PROVIDER_H
+#define ERD_ASYNC_PROXY_PROVIDER_H
+
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+
+#include "provider/proxyprovider.h"
+
+namespace util
+{
+class ThreadPool;
+}
+
+#define DEFAULT_MAX_REQUESTS_IN_FLIGHT 1024U
+
+// Runs ProxyProvider requests on an internal pool of I/O threads, one per pooled connection (config.maxConnections).
+// At most maxInFlight requests are queued or running; further calls block until one completes (backpressure).
+// Each request is available either as a std::future or with completion callbacks, which run on an I/O thread.
+// Callbacks may issue further async requests without blocking; exceptions escaping them are discarded.
+// The destructor waits for all requests in flight.
+class AsyncProxyProvider
+{
+public:
+    template<typename T>
+    using SuccessCallback = std::function<void(T)>;
+
+    typedef std::function<void(std::exception_ptr)> ErrorCallback;
+
+    explicit AsyncProxyProvider(std::string url,
+                                ProxyProviderConfig const &config = ProxyProviderConfig(),
+                                std::size_t maxInFlight = DEFAULT_MAX_REQUESTS_IN_FLIGHT);
+
+    ~AsyncProxyProvider();
+
+    AsyncProxyProvider(AsyncProxyProvider const &) = delete;
+
+    AsyncProxyProvider &operator=(AsyncProxyProvider const &) = delete;
+
+    std::future<Account> getAccount(Address const &address);
+
+    void getAccount(Address const &address, SuccessCallback<Account> onSuccess, ErrorCallback onError);
+
+    std::future<std::string> send(Transaction const &transaction);
+
+    void send(Transaction const &transaction, SuccessCallback<std::string> onSuccess, ErrorCallback onError);
+
+    std::future<TransactionStatus> getTransactionStatus(std::string const &txHash);
+
+    void getTransactionStatus(std::string const &txHash, SuccessCallback<TransactionStatus> onSuccess, ErrorCallback onError);
+
+    std::future<BigUInt> getESDTBalance(Address const &address, std::string const &token);
+
+    void getESDTBalance(Address const &address, std::string const &token, SuccessCallback<BigUInt> onSuccess, ErrorCallback onError);
+
+    std::future<NetworkConfig> getNetworkConfig();
+
+    void getNetworkConfig(SuccessCallback<NetworkConfig> onSuccess, ErrorCallback onError);
+
+    // Number of requests queued or running
+    std::size_t numInFlight() const;
+
+private:
+    ProxyProvider m_proxy;
+    // Declared last so that it is destroyed, and its pending requests completed, before m_proxy
+    std::unique_ptr<util::ThreadPool> m_threadPool;
+};
+
+#endif //ERD_ASYNC_PROXY_PROVIDER_H
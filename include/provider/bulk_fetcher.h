@@ -0,0 +1,88 @@
+#ifndef ERD_BULK_FETCHER_H
+#define ERD_BULK_FETCHER_H
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "provider/proxyprovider.h"
+
+namespace wrapper
+{
+namespace http
+{
+class ClientPool;
+}
+}
+
+namespace util
+{
+class RateLimiter;
+
+class ThreadPool;
+}
+
+struct BulkFetchConfig
+{
+    // Requests in flight at once, each on its own keep-alive connection
+    std::size_t maxConcurrency = 16;
+    // Requests started per second to the proxy host, 0 for no limit. Retries count as requests.
+    double maxRequestsPerSecond = 0;
+    // Requests that may start at once after an idle period
+    std::size_t burst = 1;
+    // Retries of a request after a transient failure: no response, 429, 502, 503 or 504
+    unsigned int maxRetries = 3;
+    // Retry delays grow exponentially from initialBackoff up to maxBackoff, with jitter
+    std::chrono::milliseconds initialBackoff = std::chrono::milliseconds(100);
+    std::chrono::milliseconds maxBackoff = std::chrono::seconds(5);
+};
+
+// Fetches accounts or ESDT balances of many addresses from one proxy, config.maxConcurrency at a time.
+// Results are streamed to the callbacks as their requests complete, together with the index of their address.
+// Callbacks run on worker threads, concurrently with each other; exceptions escaping them are discarded and
+// they must not start another bulk fetch on the same fetcher. Each bulk fetch returns once all its callbacks ran.
+// The connection timeouts of proxyConfig apply, its maxConnections and cache settings are ignored.
+class BulkProxyFetcher
+{
+public:
+    template<typename T>
+    using ResultCallback = std::function<void(std::size_t index, T result)>;
+
+    typedef std::function<void(std::size_t index, std::exception_ptr error)> ErrorCallback;
+
+    explicit BulkProxyFetcher(std::string url,
+                              ProxyProviderConfig const &proxyConfig = ProxyProviderConfig(),
+                              BulkFetchConfig const &config = BulkFetchConfig());
+
+    ~BulkProxyFetcher();
+
+    BulkProxyFetcher(BulkProxyFetcher const &) = delete;
+
+    BulkProxyFetcher &operator=(BulkProxyFetcher const &) = delete;
+
+    void getAccounts(std::vector<Address> const &addresses, ResultCallback<Account> onAccount, ErrorCallback onError);
+
+    void getAllESDTBalances(std::vector<Address> const &addresses,
+                            ResultCallback<std::map<std::string, BigUInt>> onBalances,
+                            ErrorCallback onError);
+
+    // Number of requests retried after a transient failure, since construction
+    uint64_t numRetries() const;
+
+private:
+    template<typename T, typename Read>
+    void fetchAll(std::vector<Address> const &addresses, std::string const &pathSuffix, Read read,
+                  ResultCallback<T> const &onResult, ErrorCallback const &onError);
+
+    std::string fetch(std::string const &path);
+
+    BulkFetchConfig const m_config;
+    std::shared_ptr<wrapper::http::ClientPool> m_pool;
+    std::unique_ptr<util::RateLimiter> m_rateLimiter;
+    std::atomic<uint64_t> m_numRetries;
+    std::unique_ptr<util::ThreadPool> m_threadPool;
+};
+
+#endif //ERD_BULK_FETCHER_H
@@ -26,5 +26,13 @@ private:
     std::string m_status;
 };
 
+// Outcome of sending one transaction of a batch: the hash if the proxy accepted it, otherwise the reason it was not sent
+struct TransactionSendResult
+{
+    bool sent;
+    std::string txHash;
+    std::string error;
+};
+
 #endif
 
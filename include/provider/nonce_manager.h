@@ -0,0 +1,98 @@
+#ifndef ERD_NONCE_MANAGER_H
+#define ERD_NONCE_MANAGER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "provider/proxyprovider.h"
+
+// Hands out nonces per sender without fetching the account before every send. The first use of a sender
+// fetches its account nonce; after that, nonces come from an atomic counter.
+// Each acquired nonce should be either confirmed (the transaction was accepted) or released (it was not sent).
+// Released nonces other than the latest one leave gaps, which later acquire() calls fill first, since
+// transactions with higher nonces can not execute before the gaps are filled.
+// If the proxy rejects nonces (e.g. transactions sent by another process), call resync().
+// Safe to use from multiple threads.
+class NonceManager
+{
+public:
+    // Nonces of one sender. Resolve it once with sender() and keep it: its acquire() is a single atomic
+    // increment while there are no gaps, without looking the sender up again. Valid as long as its manager.
+    class Sender
+    {
+    public:
+        explicit Sender(uint64_t nonce);
+
+        Sender(Sender const &) = delete;
+
+        Sender &operator=(Sender const &) = delete;
+
+        uint64_t acquire();
+
+        void confirm(uint64_t nonce);
+
+        void release(uint64_t nonce);
+
+        // Nonces acquired but neither confirmed nor released, in increasing order
+        std::vector<uint64_t> getOutstanding() const;
+
+        // Released nonces not handed out again yet, in increasing order
+        std::vector<uint64_t> getGaps() const;
+
+    private:
+        friend class NonceManager;
+
+        void reset(uint64_t nonce);
+
+        // Lock free state, read and updated by acquire() and release()
+        std::atomic<uint64_t> m_next;
+        std::atomic<std::size_t> m_numGaps;
+
+        // Bookkeeping of confirmed and released nonces, guarded by m_mutex
+        mutable std::mutex m_mutex;
+        // All nonces below were confirmed, or predate the last sync
+        uint64_t m_confirmedFloor;
+        // Confirmed nonces above m_confirmedFloor
+        std::set<uint64_t> m_confirmed;
+        std::set<uint64_t> m_gaps;
+    };
+
+    explicit NonceManager(ProxyProvider proxy);
+
+    ~NonceManager();
+
+    NonceManager(NonceManager const &) = delete;
+
+    NonceManager &operator=(NonceManager const &) = delete;
+
+    // Fetches the account nonce on first use
+    Sender &sender(Address const &sender);
+
+    uint64_t acquire(Address const &sender);
+
+    void confirm(Address const &sender, uint64_t nonce);
+
+    void release(Address const &sender, uint64_t nonce);
+
+    // Restarts allocation from the account nonce on chain, forgetting outstanding nonces and gaps. Returns that nonce.
+    uint64_t resync(Address const &sender);
+
+    std::vector<uint64_t> getOutstanding(Address const &sender) const;
+
+    std::vector<uint64_t> getGaps(Address const &sender) const;
+
+private:
+    Sender *findSender(Address const &sender) const;
+
+    ProxyProvider m_proxy;
+
+    mutable std::shared_timed_mutex m_sendersMutex;
+    std::unordered_map<Address, std::unique_ptr<Sender>> m_senders;
+};
+
+#endif //ERD_NONCE_MANAGER_H
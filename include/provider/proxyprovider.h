@@ -1,22 +1,97 @@
 #ifndef ERD_PROXY_PROVIDER_H
 #define ERD_PROXY_PROVIDER_H
 
+#include <chrono>
 #include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "data/ext.h"
 #include "account/account.h"
 #include "account/address.h"
 #include "transaction/transaction.h"
 
+namespace wrapper
+{
+namespace http
+{
+class ResilientClient;
+}
+}
+
+namespace internal
+{
+class ProxyCache;
+}
+
+// Caching of rarely changing reads, disabled by default. A zero ttl disables caching of that endpoint.
+struct ProxyProviderCacheConfig
+{
+    std::chrono::milliseconds networkConfigTtl = std::chrono::milliseconds(0);
+    std::chrono::milliseconds accountTtl = std::chrono::milliseconds(0);
+    std::chrono::milliseconds esdtBalanceTtl = std::chrono::milliseconds(0);
+    // For this long after their ttl, cached values are still returned while being refreshed in the background
+    std::chrono::milliseconds staleWhileRevalidate = std::chrono::milliseconds(0);
+};
+
+struct ProxyProviderCacheStats
+{
+    uint64_t hits;
+    // Expired values returned while being refreshed
+    uint64_t staleHits;
+    uint64_t misses;
+};
+
+// Retries, deadlines and failover of requests
+struct ProxyProviderResilienceConfig
+{
+    // Equivalent proxies, used in order when the ones before them are unavailable
+    std::vector<std::string> fallbackUrls;
+    // Retries of a read after a transient failure (no response, 429, 502, 503 or 504), each on the next available
+    // proxy. Transactions are sent once, to the first available proxy.
+    unsigned int maxRetries = 2;
+    // Retry delays grow exponentially from initialBackoff up to maxBackoff, with jitter
+    std::chrono::milliseconds initialBackoff = std::chrono::milliseconds(50);
+    std::chrono::milliseconds maxBackoff = std::chrono::seconds(1);
+    // Time budget of a request including its retries, 0 for none
+    std::chrono::milliseconds deadline = std::chrono::milliseconds(0);
+    // Consecutive transient failures after which a proxy is skipped for openDuration, then probed by a single
+    // request at a time until one succeeds. 0 to never skip proxies.
+    unsigned int failureThreshold = 5;
+    std::chrono::milliseconds openDuration = std::chrono::seconds(10);
+};
+
+struct ProxyProviderConfig
+{
+    // Maximum number of keep-alive connections per proxy, and so of requests in flight at once to each
+    std::size_t maxConnections = 8;
+    // Pooled connections unused for longer are closed instead of being reused
+    std::chrono::milliseconds idleTimeout = std::chrono::seconds(30);
+    std::chrono::milliseconds connectionTimeout = std::chrono::seconds(10);
+    std::chrono::milliseconds readTimeout = std::chrono::seconds(5);
+    std::chrono::milliseconds writeTimeout = std::chrono::seconds(5);
+    // Maximum number of transactions posted in one sendBatch() request
+    std::size_t sendBatchSize = 100;
+    ProxyProviderCacheConfig cache;
+    ProxyProviderResilienceConfig resilience;
+};
+
+// Safe to use from multiple threads. Copies share the same connection pool and cache.
+// Sending a transaction invalidates the cached account and ESDT balances of its sender.
 class ProxyProvider
 {
 public:
-    explicit ProxyProvider(std::string url);
+    explicit ProxyProvider(std::string url, ProxyProviderConfig const &config = ProxyProviderConfig());
 
     Account getAccount(Address const &address);
 
     std::string send(Transaction const &transaction);
 
+    // Sends the transactions through /transaction/send-multiple, sendBatchSize transactions per request.
+    // Returns one result per transaction, in the same order. Failures are reported per transaction instead of thrown.
+    std::vector<TransactionSendResult> sendBatch(std::vector<Transaction> const &transactions);
+
     TransactionStatus getTransactionStatus(std::string const &txHash);
 
     BigUInt getESDTBalance(Address const &address, std::string const &token) const;
@@ -25,8 +100,20 @@ public:
 
     NetworkConfig getNetworkConfig() const;
 
+    // All zero if caching is disabled
+    ProxyProviderCacheStats getCacheStats() const;
+
+    void invalidateCache();
+
+    void invalidateNetworkConfig();
+
+    // Drops the cached account and ESDT balances of the address
+    void invalidateAccount(Address const &address);
+
 private:
-    std::string m_url;
+    std::shared_ptr<wrapper::http::ResilientClient> m_client;
+    std::shared_ptr<internal::ProxyCache> m_cache;
+    std::size_t m_sendBatchSize;
 };
 
 #endif //ERD_PROXY_PROVIDER_H
@@ -0,0 +1,110 @@
+#ifndef ERD_TRANSACTION_WATCHER_H
+#define ERD_TRANSACTION_WATCHER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "provider/async_proxyprovider.h"
+
+struct TransactionWatcherConfig
+{
+    // Delay before the first poll of a hash and after each status change
+    std::chrono::milliseconds initialInterval = std::chrono::milliseconds(500);
+    // The delay grows by backoffMultiplier after each poll without a status change, up to maxInterval
+    std::chrono::milliseconds maxInterval = std::chrono::seconds(10);
+    double backoffMultiplier = 2.0;
+    // Each delay is randomized within +/- jitter of its value, so hashes watched together do not poll together
+    double jitter = 0.2;
+    // Watches not completed after this long fail, zero waits forever
+    std::chrono::milliseconds timeout = std::chrono::minutes(10);
+    // Maximum number of status requests queued or running
+    std::size_t maxPollsInFlight = 256;
+};
+
+// Polls the status of many transactions until each one is executed or failed, then resolves its future or fires
+// its callback. All hashes share the connection pool of one AsyncProxyProvider, and watching the same hash several
+// times polls it only once. Failed polls (e.g. a transaction not yet known by the proxy) are retried with backoff,
+// except for malformed responses and requests the proxy rejects as bad, which fail the watch with that error.
+// A watch that times out fails with the reason of its last failed poll, if any.
+// Completion callbacks run on an I/O thread. The destructor fails all watches still pending.
+class TransactionWatcher
+{
+public:
+    typedef std::function<void(TransactionStatus const &)> CompletionCallback;
+
+    typedef std::function<void(std::exception_ptr)> ErrorCallback;
+
+    explicit TransactionWatcher(std::string url,
+                                ProxyProviderConfig const &proxyConfig = ProxyProviderConfig(),
+                                TransactionWatcherConfig const &config = TransactionWatcherConfig());
+
+    ~TransactionWatcher();
+
+    TransactionWatcher(TransactionWatcher const &) = delete;
+
+    TransactionWatcher &operator=(TransactionWatcher const &) = delete;
+
+    std::future<TransactionStatus> watch(std::string const &txHash);
+
+    void watch(std::string const &txHash, CompletionCallback onCompleted, ErrorCallback onError);
+
+    // Number of distinct hashes being watched
+    std::size_t numWatched() const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Waiter
+    {
+        CompletionCallback onCompleted;
+        ErrorCallback onError;
+    };
+
+    struct Watch
+    {
+        std::vector<Waiter> waiters;
+        std::chrono::milliseconds interval;
+        Clock::time_point deadline;
+        TransactionStatus lastStatus;
+        // Error of the last failed poll, reported if the watch times out
+        std::exception_ptr lastError;
+    };
+
+    typedef std::pair<Clock::time_point, std::string> ScheduledPoll;
+
+    void schedule(std::string const &txHash, std::chrono::milliseconds interval);
+
+    void runScheduler();
+
+    void onPolled(std::string const &txHash, TransactionStatus const *status, std::exception_ptr error);
+
+    static void complete(std::vector<Waiter> const &waiters, TransactionStatus const &status);
+
+    static void fail(std::vector<Waiter> const &waiters, std::exception_ptr const &error);
+
+    static void fail(Waiter const &waiter, std::exception_ptr const &error);
+
+    TransactionWatcherConfig const m_config;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_scheduleChanged;
+    std::unordered_map<std::string, Watch> m_watches;
+    std::priority_queue<ScheduledPoll, std::vector<ScheduledPoll>, std::greater<ScheduledPoll>> m_schedule;
+    std::mt19937 m_rng;
+    bool m_stopping;
+
+    std::unique_ptr<AsyncProxyProvider> m_proxy;
+    std::thread m_scheduler;
+};
+
+#endif //ERD_TRANSACTION_WATCHER_H
@@ -14,6 +14,8 @@ public:
 
     std::string asOnData() const;
 
+    void appendOnData(bytes &out) const;
+
 private:
     std::string m_function;
     SCArguments m_args;
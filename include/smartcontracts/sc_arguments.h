@@ -21,6 +21,9 @@ public:
 
     std::string asOnData() const;
 
+    // Appends "@arg1@arg2..." to out
+    void appendOnData(bytes &out) const;
+
 private:
     std::vector<std::string> m_args;
 };
@@ -0,0 +1,63 @@
+#ifndef ERD_ESDT_TRANSFER_TEMPLATE_H
+#define ERD_ESDT_TRANSFER_TEMPLATE_H
+
+#include "gas_estimator.h"
+#include "transaction.h"
+#include "smartcontracts/contract_call.h"
+
+#include <vector>
+
+class TransactionFactory;
+
+// Per transaction fields of an ESDT transfer built from a template
+struct ESDTTransferTarget
+{
+    uint64_t nonce;
+    Address receiver;
+    BigUInt amount;
+};
+
+// Prototype of ESDT transfers of the same token and sender, e.g. the transfers of a payout, which only differ by
+// nonce, receiver and amount. The payload around the amount (transfer function, hex encoded token identifier and
+// contract call) is encoded once; building a transaction only encodes its amount and patches its varying fields.
+// Transactions are the same as built by TransactionFactory::createESDTTransfer() with a fungible token payment.
+// Created by TransactionFactory::createESDTTransferTemplate().
+class ESDTTransferTemplate
+{
+    friend class TransactionFactory;
+
+public:
+    ESDTTransferTemplate &withContractCall(ContractCall const &contractCall);
+
+    ESDTTransferTemplate &withVersion(uint64_t version);
+
+    ESDTTransferTemplate &withOptions(uint32_t options);
+
+    Transaction build(uint64_t nonce, Address const &receiver, BigUInt const &amount) const;
+
+    // Overwrites every field of the transaction, reusing its data buffer. The transaction is left unsigned.
+    void build(uint64_t nonce, Address const &receiver, BigUInt const &amount, Transaction &out) const;
+
+    // Builds one transaction per target into out, resized to the number of targets. Transactions already in out are
+    // patched in place, so that building successive batches into the same vector reuses their buffers.
+    void build(std::vector<ESDTTransferTarget> const &targets, std::vector<Transaction> &out) const;
+
+private:
+    explicit ESDTTransferTemplate(std::string const &tokenIdentifier,
+                                  Address const &sender,
+                                  uint64_t gasPrice,
+                                  std::string chainID,
+                                  GasEstimator gasEstimator);
+
+    // Payload up to, and after, the amount argument
+    bytes m_payloadPrefix;
+    bytes m_payloadSuffix;
+    Address m_sender;
+    uint64_t m_gasPrice;
+    std::string m_chainID;
+    GasEstimator m_gasEstimator;
+    uint64_t m_version;
+    Optional<uint32_t> m_options;
+};
+
+#endif //ERD_ESDT_TRANSFER_TEMPLATE_H
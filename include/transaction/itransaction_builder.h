@@ -14,7 +14,10 @@ public:
 
     ITransactionBuilder &withOptions(uint32_t options);
 
-    virtual Transaction build() = 0;
+    virtual Transaction build();
+
+    // Builds into a caller owned transaction, overwriting all of its fields and reusing its buffers
+    virtual void build(Transaction &out) = 0;
 
     Transaction buildSigned(const bytes &seed);
 
@@ -22,7 +25,7 @@ public:
 
 protected:
     uint64_t m_version;
-    std::shared_ptr<uint32_t> m_options;
+    Optional<uint32_t> m_options;
 };
 
 class ITokenTransactionBuilder : public ITransactionBuilder
@@ -0,0 +1,60 @@
+#ifndef ERD_KEY_RING_H
+#define ERD_KEY_RING_H
+
+#include "internal/internal.h"
+#include "account/address.h"
+#include "transaction/signer.h"
+#include "transaction/transaction.h"
+
+#include <cstdint>
+#include <vector>
+
+class ISecretKey;
+class PemBundle;
+
+// Signers of many accounts, e.g. the wallets of a custodial service, looked up by address in constant time.
+// Key pairs are derived once, when added, so that signing a transaction of any sender costs a single signature.
+// Signers are stored contiguously and indexed by an open addressing table keyed by their public key.
+// Adding keys is not thread safe, signing and lookups are.
+class KeyRing
+{
+public:
+    explicit KeyRing();
+
+    // Adds the signer of the seed. Returns false, keeping the existing signer, if the ring already holds its address.
+    bool add(bytes const &seed);
+
+    bool add(ISecretKey const &secretKey);
+
+    // Adds all keys of the bundle, returns how many were not already in the ring
+    std::size_t add(PemBundle const &bundle);
+
+    void reserve(std::size_t numKeys);
+
+    std::size_t size() const;
+
+    bool contains(Address const &address) const;
+
+    // Signer of the address, or nullptr if the ring has none
+    Signer const *find(Address const &address) const;
+
+    // Signs the transaction with the signer of its sender. Throws if it has no sender, or one the ring has no key of.
+    void sign(Transaction &transaction) const;
+
+    // Signs each transaction with the signer of its sender, splitting the work across numThreads threads (0 = one per core).
+    // Returns whether each transaction was signed; transactions without a sender, or with one the ring has no key of, are left untouched.
+    // Throws like Transaction::signBatch if a transaction can not be serialized.
+    std::vector<bool> signBatch(std::vector<Transaction> &transactions, unsigned int numThreads = 0) const;
+
+private:
+    // Slot of the address in m_slots: either the one holding its signer, or the empty one where it would be inserted
+    std::size_t slotOf(Address const &address) const;
+
+    void grow();
+
+    std::vector<Signer> m_signers;
+    // Index + 1 of a signer in m_signers, 0 for an empty slot. The size is a power of two, at most half of the slots are used.
+    std::vector<uint32_t> m_slots;
+};
+
+#endif //ERD_KEY_RING_H
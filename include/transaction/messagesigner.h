@@ -18,6 +18,8 @@ public:
 
     static bool verify(std::string const &signature, std::string const &message, bytes const &publicKey);
 
+    static bool verify(std::string const &signature, std::string const &message, Address::PublicKey const &publicKey);
+
     static bool verify(std::string const &signature, std::string const &message, Address const &address);
 
     static std::string computeERDPrefixedMsgHash(std::string const &message);
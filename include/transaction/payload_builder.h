@@ -8,6 +8,9 @@
 #include "transaction/token_payment.h"
 #include "smartcontracts/contract_call.h"
 
+// Each builder's build(bytes &out) appends the payload to out, e.g. directly into a transaction's data buffer,
+// instead of returning it as a string.
+
 class ESDTTransferPayloadBuilder
 {
 public:
@@ -19,6 +22,8 @@ public:
 
     std::string build() const;
 
+    void build(bytes &out) const;
+
 private:
     TokenPayment m_payment;
     ContractCall m_contractCall;
@@ -37,6 +42,8 @@ public:
 
     std::string build() const;
 
+    void build(bytes &out) const;
+
 private:
     TokenPayment m_payment;
     std::string m_destination;
@@ -56,6 +63,8 @@ public:
 
     std::string build() const;
 
+    void build(bytes &out) const;
+
 private:
     std::vector<TokenPayment> m_payments;
     std::string m_destination;
@@ -76,6 +85,8 @@ public:
     ESDTIssuePayloadBuilder &withProperties(ESDTProperties esdtProperties);
 
     std::string build() const;
+
+    void build(bytes &out) const;
 private:
     std::string m_token;
     std::string m_ticker;
@@ -4,21 +4,51 @@
 #include "internal/internal.h"
 #include "account/address.h"
 
+#include <array>
+#include <vector>
+
+struct SignedMessage
+{
+    std::string signature;
+    std::string message;
+    bytes publicKey;
+};
+
 class Signer
 {
 public:
     explicit Signer(bytes const &seed);
 
+    Signer(Signer const &other) = default;
+
+    Signer &operator=(Signer const &other) = default;
+
+    // Zeroes the secret key, so that copies left behind (e.g. by a growing std::vector<Signer>) do not keep it
+    virtual ~Signer();
+
     virtual std::string getSignature(std::string const &message) const;
 
+    // Writes the SIGNATURE_LENGTH bytes of the signature of message to signature, without allocating
+    void sign(std::string const &message, uint8_t *signature) const;
+
     virtual bool verify(std::string const &signature, std::string const &message) const;
 
     static bool verify(std::string const &signature, std::string const &message, bytes const &publicKey);
 
+    static bool verify(std::string const &signature, std::string const &message, Address::PublicKey const &publicKey);
+
     static bool verify(std::string const &signature, std::string const &message, Address const &address);
 
+    // Verifies each signed message, splitting the work across numThreads threads (0 = one per core).
+    // Returns one result per message, in the same order. Malformed signatures or public keys are reported as invalid.
+    static std::vector<bool> verifyBatch(std::vector<SignedMessage> const &signedMessages, unsigned int numThreads = 0);
+
+    Address const &getAddress() const;
+
 private:
-    bytes m_sk;
+    // Key pair and address are derived once, at construction. The address holds the public key.
+    std::array<uint8_t, SECRET_KEY_LENGTH> m_sk;
+    Address m_address;
 };
 
 
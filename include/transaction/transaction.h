@@ -2,12 +2,13 @@
 #define ERD_TRANSACTION_H
 
 #include "internal/biguint.h"
+#include "internal/optional.h"
 #include "account/address.h"
 #include "transaction/signer.h"
 
 #include <cstdint>
 #include <string>
-#include <memory>
+#include <vector>
 
 #define DEFAULT_NONCE 0U
 #define DEFAULT_VALUE BigUInt(0)
@@ -31,15 +32,15 @@ public:
             BigUInt value,
             Address const &receiver,
             Address const &sender,
-            std::shared_ptr<bytes> receiverUserName,
-            std::shared_ptr<bytes> senderUserName,
+            Optional<bytes> receiverUserName,
+            Optional<bytes> senderUserName,
             uint64_t const &gasPrice,
             uint64_t const &gasLimit,
-            std::shared_ptr<bytes> data,
-            std::shared_ptr<std::string> signature,
+            Optional<bytes> data,
+            Optional<std::string> signature,
             std::string chainID,
             uint64_t const &version,
-            std::shared_ptr<uint32_t> m_options);
+            Optional<uint32_t> options);
 
     explicit Transaction();
 
@@ -49,25 +50,35 @@ public:
 
     void sign(Signer const &signer);
 
+    // Signs all transactions with the same signer, splitting the work across numThreads threads (0 = one per core)
+    static void signBatch(std::vector<Transaction> &transactions, Signer const &signer, unsigned int numThreads = 0);
+
     bool verify();
 
+    // Verifies the signatures of all transactions against their senders, splitting the work across numThreads threads
+    // (0 = one per core). Returns one result per transaction; transactions without a valid signature or sender are invalid.
+    static std::vector<bool> verifyBatch(std::vector<Transaction> const &transactions, unsigned int numThreads = 0);
+
     std::string serialize() const;
 
+    void serialize(std::string &buffer) const;
+
     void deserialize(std::string const& serializedTransaction);
 
+    // Optional fields are stored inline, nullptr when unset: a transaction only allocates for its data, signature and user names
     uint64_t m_nonce;
     BigUInt m_value;
-    std::shared_ptr<bytes> m_receiverUserName;
-    std::shared_ptr<bytes> m_senderUserName;
-    std::shared_ptr<Address> m_receiver;
-    std::shared_ptr<Address> m_sender;
+    Optional<bytes> m_receiverUserName;
+    Optional<bytes> m_senderUserName;
+    Optional<Address> m_receiver;
+    Optional<Address> m_sender;
     uint64_t m_gasPrice;
     uint64_t m_gasLimit;
     std::string m_chainID;
     uint64_t m_version;
-    std::shared_ptr<bytes> m_data;
-    std::shared_ptr<std::string> m_signature;
-    std::shared_ptr<uint32_t> m_options;
+    Optional<bytes> m_data;
+    Optional<std::string> m_signature;
+    Optional<uint32_t> m_options;
 };
 
 #endif //ERD_TRANSACTION_H
@@ -18,11 +18,18 @@ class TransactionEGLDTransferBuilder : public ITransactionBuilder
     friend class TransactionFactory;
 
 public:
-    Transaction build() override;
+    using ITransactionBuilder::build;
+
+    void build(Transaction &out) override;
 
 private:
     explicit TransactionEGLDTransferBuilder(TransactionBuilderInput txInput);
 
+    // Shared with the TransactionFactory entry points building without a builder. A gas limit of DEFAULT_GAS_LIMIT is estimated.
+    static void assemble(Transaction &out, uint64_t nonce, BigUInt const &value, Address const &sender, Address const &receiver,
+                         std::string const &data, uint64_t gasPrice, uint64_t gasLimit, std::string const &chainID,
+                         GasEstimator const &gasEstimator, uint64_t version, Optional<uint32_t> const &options);
+
     TransactionBuilderInput m_txInput;
 };
 
@@ -32,11 +39,17 @@ class TransactionESDTBuilder : public ITokenTransactionBuilder
     friend class TransactionFactory;
 
 public:
-    Transaction build() override;
+    using ITransactionBuilder::build;
+
+    void build(Transaction &out) override;
 
 private:
     explicit TransactionESDTBuilder(TransactionBuilderInput txInput, TokenPayment payment);
 
+    static void assemble(Transaction &out, TokenPayment const &payment, ContractCall const &contractCall, uint64_t nonce,
+                         Address const &sender, Address const &receiver, uint64_t gasPrice, std::string const &chainID,
+                         GasEstimator const &gasEstimator, uint64_t version, Optional<uint32_t> const &options);
+
     TransactionBuilderInput m_txInput;
     TokenPayment m_tokenPayment;
 };
@@ -47,11 +60,17 @@ class TransactionESDTNFTBuilder : public ITokenTransactionBuilder
     friend class TransactionFactory;
 
 public:
-    Transaction build() override;
+    using ITransactionBuilder::build;
+
+    void build(Transaction &out) override;
 
 private:
     explicit TransactionESDTNFTBuilder(TransactionBuilderInput txInput, TokenPayment payment);
 
+    static void assemble(Transaction &out, TokenPayment const &payment, ContractCall const &contractCall, uint64_t nonce,
+                         Address const &sender, Address const &destination, uint64_t gasPrice, std::string const &chainID,
+                         GasEstimator const &gasEstimator, uint64_t version, Optional<uint32_t> const &options);
+
     TransactionBuilderInput m_txInput;
     TokenPayment m_tokenPayment;
 };
@@ -62,11 +81,17 @@ class TransactionMultiESDTNFTBuilder : public ITokenTransactionBuilder
     friend class TransactionFactory;
 
 public:
-    Transaction build() override;
+    using ITransactionBuilder::build;
+
+    void build(Transaction &out) override;
 
 private:
     explicit TransactionMultiESDTNFTBuilder(TransactionBuilderInput txInput, std::vector<TokenPayment> payments);
 
+    static void assemble(Transaction &out, std::vector<TokenPayment> const &payments, ContractCall const &contractCall, uint64_t nonce,
+                         Address const &sender, Address const &destination, uint64_t gasPrice, std::string const &chainID,
+                         GasEstimator const &gasEstimator, uint64_t version, Optional<uint32_t> const &options);
+
     TransactionBuilderInput m_txInput;
     std::vector<TokenPayment> m_tokenPayments;
 };
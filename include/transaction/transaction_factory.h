@@ -5,6 +5,7 @@
 #include "gas_estimator.h"
 #include "token_payment.h"
 #include "itransaction_builder.h"
+#include "esdt_transfer_template.h"
 
 class TransactionFactory
 {
@@ -33,6 +34,11 @@ public:
                                                                  Address receiver,
                                                                  uint64_t gasPrice);
 
+    // Template of createESDTTransfer() transactions of a fungible token, for many transfers differing only by nonce, receiver and amount
+    ESDTTransferTemplate createESDTTransferTemplate(std::string const &tokenIdentifier,
+                                                   Address const &sender,
+                                                   uint64_t gasPrice) const;
+
     std::unique_ptr<ITokenTransactionBuilder> createESDTNFTTransfer(TokenPayment tokenPayment,
                                                                     uint64_t nonce,
                                                                     Address sender,
@@ -45,6 +51,38 @@ public:
                                                                          Address destination,
                                                                          uint64_t gasPrice);
 
+    // Entry points building directly into a caller owned transaction, without allocating a builder: all fields of the
+    // transaction are overwritten and its buffers reused. Transactions are the same as the ones of the create*() builders,
+    // with the default version and options and no contract call.
+    void buildEGLDTransfer(Transaction &out,
+                           uint64_t nonce,
+                           BigUInt const &value,
+                           Address const &sender,
+                           Address const &receiver,
+                           uint64_t gasPrice,
+                           std::string const &data = std::string()) const;
+
+    void buildESDTTransfer(Transaction &out,
+                           TokenPayment const &tokenPayment,
+                           uint64_t nonce,
+                           Address const &sender,
+                           Address const &receiver,
+                           uint64_t gasPrice) const;
+
+    void buildESDTNFTTransfer(Transaction &out,
+                              TokenPayment const &tokenPayment,
+                              uint64_t nonce,
+                              Address const &sender,
+                              Address const &destination,
+                              uint64_t gasPrice) const;
+
+    void buildMultiESDTNFTTransfer(Transaction &out,
+                                   std::vector<TokenPayment> const &tokenPayments,
+                                   uint64_t nonce,
+                                   Address const &sender,
+                                   Address const &destination,
+                                   uint64_t gasPrice) const;
+
 private:
     std::string m_chainID;
     GasEstimator m_gasEstimator;
@@ -1,62 +1,165 @@
 #include "account/address.h"
-#include "bits.h"
-#include "bech32/bech32.h"
+#include "address_codec.h"
 #include "errors.h"
 
-#include <cryptosignwrapper.h>
+#include <algorithm>
 #include <stdexcept>
+#include <utility>
 
-Address::Address(bytes const &publicKey) :
-        m_pk(publicKey)
+namespace
+{
+Address::PublicKey publicKeyFromBytes(bytes const &publicKey)
 {
     if (publicKey.size() != PUBLIC_KEY_LENGTH)
         throw std::length_error(ERROR_MSG_KEY_BYTES_SIZE);
 
-    m_bech32Address = computeBech32Address();
+    Address::PublicKey pk;
+    std::copy(publicKey.begin(), publicKey.end(), pk.begin());
+    return pk;
 }
 
-Address::Address(std::string const &bech32Address) :
-        m_bech32Address(bech32Address)
+Address::PublicKey publicKeyFromBech32(std::string const &bech32Address)
 {
-    if (util::bech32::decode(bech32Address).first != hrp)
+    Address::PublicKey pk;
+    if (!internal::decodeBech32Address(bech32Address.data(), bech32Address.size(), pk.data()))
         throw std::invalid_argument(ERROR_MSG_BECH32);
 
-    m_pk = computePkFromBech32();
+    return pk;
+}
+
+std::string const *copyIfNotNull(std::string const *str)
+{
+    return (str != nullptr) ? new std::string(*str) : nullptr;
+}
+}
+
+Address::Address(bytes const &publicKey) :
+        m_pk(publicKeyFromBytes(publicKey)),
+        m_bech32Address(nullptr)
+{}
+
+Address::Address(PublicKey const &publicKey) :
+        m_pk(publicKey),
+        m_bech32Address(nullptr)
+{}
+
+Address::Address(std::string const &bech32Address) :
+        m_pk(publicKeyFromBech32(bech32Address)),
+        m_bech32Address(nullptr)
+{}
+
+Address::Address(Address const &other) :
+        m_pk(other.m_pk),
+        m_bech32Address(copyIfNotNull(other.m_bech32Address.load(std::memory_order_acquire)))
+{}
+
+Address::Address(Address &&other) noexcept :
+        m_pk(other.m_pk),
+        m_bech32Address(other.m_bech32Address.exchange(nullptr, std::memory_order_acq_rel))
+{}
+
+Address &Address::operator=(Address const &rhs)
+{
+    if (this != &rhs)
+    {
+        std::string const *bech32Address = copyIfNotNull(rhs.m_bech32Address.load(std::memory_order_acquire));
+
+        m_pk = rhs.m_pk;
+        delete m_bech32Address.exchange(bech32Address, std::memory_order_acq_rel);
+    }
+
+    return *this;
+}
+
+Address &Address::operator=(Address &&rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        m_pk = rhs.m_pk;
+        delete m_bech32Address.exchange(rhs.m_bech32Address.exchange(nullptr, std::memory_order_acq_rel),
+                                        std::memory_order_acq_rel);
+    }
+
+    return *this;
+}
+
+Address::~Address()
+{
+    delete m_bech32Address.load(std::memory_order_relaxed);
 }
 
 bool Address::operator==(const Address &address) const
 {
-    return this->m_pk == address.m_pk;
+    return m_pk == address.m_pk;
 }
 
-bytes Address::getPublicKey() const
+bool Address::operator!=(const Address &address) const
+{
+    return !(*this == address);
+}
+
+Address::PublicKey const &Address::getPublicKey() const
 {
     return m_pk;
 }
 
-std::string Address::getBech32Address() const
+std::string const &Address::getBech32Address() const
 {
-    return m_bech32Address;
+    std::string const *bech32Address = m_bech32Address.load(std::memory_order_acquire);
+    if (bech32Address != nullptr)
+    {
+        return *bech32Address;
+    }
+
+    // Several threads may encode concurrently; the first one to publish its result wins
+    std::string const *computed = new std::string(computeBech32Address());
+    if (m_bech32Address.compare_exchange_strong(bech32Address, computed, std::memory_order_acq_rel))
+    {
+        return *computed;
+    }
+
+    delete computed;
+    return *bech32Address;
 }
 
-std::string Address::computeBech32Address() const
+std::vector<Address> Address::fromBech32(std::vector<std::string> const &bech32Addresses)
 {
-    bytes const pk5BitsPerByte = util::convertBits(m_pk, kNoBitsInByte, kNoBitsInBech32, true);
+    std::vector<Address> addresses;
+    addresses.reserve(bech32Addresses.size());
 
-    return util::bech32::encode(hrp, pk5BitsPerByte);
+    for (auto const &bech32Address: bech32Addresses)
+    {
+        addresses.emplace_back(publicKeyFromBech32(bech32Address));
+    }
+
+    return addresses;
 }
 
-bytes Address::computePkFromBech32() const
+std::vector<std::string> Address::toBech32(std::vector<Address> const &addresses)
 {
-    bytes const pk5BitsPerByte = util::bech32::decode(m_bech32Address).second;
+    std::vector<std::string> bech32Addresses;
+    bech32Addresses.reserve(addresses.size());
+
+    for (auto const &address: addresses)
+    {
+        std::string const *cached = address.m_bech32Address.load(std::memory_order_acquire);
+        if (cached != nullptr)
+        {
+            bech32Addresses.emplace_back(*cached);
+        }
+        else
+        {
+            bech32Addresses.emplace_back(address.computeBech32Address());
+        }
+    }
 
-    return util::convertBits(pk5BitsPerByte, kNoBitsInBech32, kNoBitsInByte, false);
+    return bech32Addresses;
 }
 
-Address &Address::operator=(const Address &rhs)
+std::string Address::computeBech32Address() const
 {
-    this->m_pk = rhs.getPublicKey();
-    this->m_bech32Address = rhs.getBech32Address();
+    std::string bech32Address(BECH32_ADDRESS_LENGTH, '\0');
+    internal::encodeBech32Address(m_pk.data(), &bech32Address[0]);
 
-    return *this;
+    return bech32Address;
 }
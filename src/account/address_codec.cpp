@@ -0,0 +1,166 @@
+#include "address_codec.h"
+
+#include "internal/internal.h"
+
+#define ADDRESS_HRP "erd"
+#define ADDRESS_HRP_LENGTH 3U
+#define BECH32_DATA_LENGTH 52U
+#define BECH32_CHECKSUM_LENGTH 6U
+
+namespace
+{
+char const CHARSET[] = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
+
+// Maps lowercase and uppercase characters to their 5 bit value, -1 for characters outside the charset
+int8_t const CHARSET_REV[128] = {
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        15, -1, 10, 17, 21, 20, 26, 30,  7,  5, -1, -1, -1, -1, -1, -1,
+        -1, 29, -1, 24, 13, 25,  9,  8, 23, -1, 18, 22, 31, 27, 19, -1,
+         1,  0,  3, 16, 11, 28, 12, 14,  6,  4,  2, -1, -1, -1, -1, -1,
+        -1, 29, -1, 24, 13, 25,  9,  8, 23, -1, 18, 22, 31, 27, 19, -1,
+         1,  0,  3, 16, 11, 28, 12, 14,  6,  4,  2, -1, -1, -1, -1, -1
+};
+
+// One step of the bech32 checksum (see PolyMod in external/bech32 for the math)
+constexpr uint32_t polyModStep(uint32_t c, uint8_t value)
+{
+    uint32_t const c0 = c >> 25;
+    c = ((c & 0x1ffffff) << 5) ^ value;
+
+    if (c0 & 1)  c ^= 0x3b6a57b2;
+    if (c0 & 2)  c ^= 0x26508e6d;
+    if (c0 & 4)  c ^= 0x1ea119fa;
+    if (c0 & 8)  c ^= 0x3d4233dd;
+    if (c0 & 16) c ^= 0x2a1462b3;
+
+    return c;
+}
+
+// Checksum state after the expanded hrp, which is the same for every address
+constexpr uint32_t computeHrpPolyMod()
+{
+    uint32_t c = 1;
+
+    for (std::size_t i = 0; i < ADDRESS_HRP_LENGTH; ++i) c = polyModStep(c, uint8_t(ADDRESS_HRP[i]) >> 5);
+    c = polyModStep(c, 0);
+    for (std::size_t i = 0; i < ADDRESS_HRP_LENGTH; ++i) c = polyModStep(c, uint8_t(ADDRESS_HRP[i]) & 0x1f);
+
+    return c;
+}
+
+constexpr uint32_t HRP_POLYMOD = computeHrpPolyMod();
+
+inline char toLower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+}
+}
+
+namespace internal
+{
+void encodeBech32Address(uint8_t const *publicKey, char *out)
+{
+    char const hrp[] = ADDRESS_HRP "1";
+    for (std::size_t i = 0; i < ADDRESS_HRP_LENGTH + 1; ++i) *out++ = hrp[i];
+
+    uint32_t checksum = HRP_POLYMOD;
+    uint32_t acc = 0;
+    unsigned int bits = 0;
+
+    for (std::size_t i = 0; i < PUBLIC_KEY_LENGTH; ++i)
+    {
+        acc = (acc << 8) | publicKey[i];
+        bits += 8;
+
+        while (bits >= 5)
+        {
+            bits -= 5;
+            uint8_t const value = (acc >> bits) & 0x1f;
+            checksum = polyModStep(checksum, value);
+            *out++ = CHARSET[value];
+        }
+    }
+
+    // 256 bits leave 1 bit behind, padded with zeros
+    uint8_t const last = (acc << (5 - bits)) & 0x1f;
+    checksum = polyModStep(checksum, last);
+    *out++ = CHARSET[last];
+
+    for (std::size_t i = 0; i < BECH32_CHECKSUM_LENGTH; ++i)
+    {
+        checksum = polyModStep(checksum, 0);
+    }
+    checksum ^= 1;
+
+    for (std::size_t i = 0; i < BECH32_CHECKSUM_LENGTH; ++i)
+    {
+        *out++ = CHARSET[(checksum >> (5 * (5 - i))) & 0x1f];
+    }
+}
+
+bool decodeBech32Address(char const *str, std::size_t const length, uint8_t *publicKey)
+{
+    if (length != BECH32_ADDRESS_LENGTH)
+    {
+        return false;
+    }
+
+    bool lower = false;
+    bool upper = false;
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        char const c = str[i];
+        lower |= (c >= 'a' && c <= 'z');
+        upper |= (c >= 'A' && c <= 'Z');
+    }
+    if (lower && upper)
+    {
+        return false;
+    }
+
+    char const hrp[] = ADDRESS_HRP "1";
+    for (std::size_t i = 0; i < ADDRESS_HRP_LENGTH + 1; ++i)
+    {
+        if (toLower(str[i]) != hrp[i])
+        {
+            return false;
+        }
+    }
+
+    uint32_t checksum = HRP_POLYMOD;
+    uint32_t acc = 0;
+    unsigned int bits = 0;
+    std::size_t written = 0;
+
+    for (std::size_t i = ADDRESS_HRP_LENGTH + 1; i < length; ++i)
+    {
+        unsigned char const c = static_cast<unsigned char>(str[i]);
+        int8_t const value = (c < 128) ? CHARSET_REV[c] : -1;
+        if (value == -1)
+        {
+            return false;
+        }
+        checksum = polyModStep(checksum, uint8_t(value));
+
+        if (i >= ADDRESS_HRP_LENGTH + 1 + BECH32_DATA_LENGTH)
+        {
+            continue; // Checksum characters
+        }
+
+        acc = ((acc << 5) | uint32_t(value)) & 0xfff;
+        bits += 5;
+        if (bits >= 8)
+        {
+            bits -= 8;
+            publicKey[written++] = uint8_t(acc >> bits);
+        }
+    }
+
+    // The padding bits of the last data character must be zero
+    bool const paddingIsZero = (acc & ((1U << bits) - 1)) == 0;
+
+    return (checksum == 1) && paddingIsZero && (written == PUBLIC_KEY_LENGTH);
+}
+}
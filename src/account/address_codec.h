@@ -0,0 +1,23 @@
+#ifndef ERD_ADDRESS_CODEC_H
+#define ERD_ADDRESS_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+
+// "erd" + separator + 52 data characters (32 bytes, 5 bits each) + 6 checksum characters
+#define BECH32_ADDRESS_LENGTH 62U
+
+namespace internal
+{
+// Bech32 codec specialised for "erd1" addresses of 32 bytes public keys. Works in a single pass over
+// stack buffers and produces the same results as util::bech32 combined with util::convertBits.
+
+// Writes exactly BECH32_ADDRESS_LENGTH lowercase characters to out.
+void encodeBech32Address(uint8_t const *publicKey, char *out);
+
+// Returns false if str is not a valid "erd1" bech32 address of a 32 bytes public key. Like the generic decoder,
+// accepts all lowercase or all uppercase strings, but not mixed case.
+bool decodeBech32Address(char const *str, std::size_t length, uint8_t *publicKey);
+}
+
+#endif //ERD_ADDRESS_CODEC_H
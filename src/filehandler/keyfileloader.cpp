@@ -0,0 +1,138 @@
+#include "filehandler/keyfileloader.h"
+#include "cryptosignwrapper.h"
+#include "errors.h"
+#include "parallel.h"
+
+#include <sodium.h>
+#include <sys/stat.h>
+#include <stdexcept>
+
+struct KeyFileCache::Entry
+{
+    Entry(Stamp const &stamp, std::size_t const secretKeySize) :
+            stamp(stamp),
+            passwordHash(KEYED_HASH_BYTES),
+            secretKey(secretKeySize)
+    {}
+
+    Stamp stamp;
+    wrapper::crypto::SecureBuffer passwordHash;
+    wrapper::crypto::SecureBuffer secretKey;
+};
+
+struct KeyFileCache::Impl
+{
+    Impl() :
+            hashKey(KEYED_HASH_KEY_BYTES)
+    {
+        wrapper::crypto::randomBytes(hashKey.data(), hashKey.size());
+    }
+
+    // Passwords are compared through a hash keyed with a random key of this cache, never stored
+    void hashPassword(std::string const &password, uint8_t *hash) const
+    {
+        wrapper::crypto::keyedHash(hashKey.data(), password, hash);
+    }
+
+    wrapper::crypto::SecureBuffer hashKey;
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, std::unique_ptr<Entry>> entries;
+};
+
+bool KeyFileCache::Stamp::operator==(Stamp const &other) const
+{
+    return modificationTime == other.modificationTime && modificationTimeNs == other.modificationTimeNs &&
+           size == other.size && inode == other.inode;
+}
+
+KeyFileCache::KeyFileCache() :
+        m_impl(new Impl())
+{}
+
+KeyFileCache::~KeyFileCache() = default;
+
+std::size_t KeyFileCache::size() const
+{
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    return m_impl->entries.size();
+}
+
+void KeyFileCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->entries.clear();
+}
+
+KeyFileCache::Stamp KeyFileCache::stampOf(std::string const &filePath)
+{
+    struct stat info{};
+    if (stat(filePath.c_str(), &info) != 0)
+    {
+        throw std::invalid_argument(ERROR_MSG_FILE_DOES_NOT_EXIST + filePath);
+    }
+
+#ifdef __APPLE__
+    int64_t const modificationTimeNs = info.st_mtimespec.tv_nsec;
+#else
+    int64_t const modificationTimeNs = info.st_mtim.tv_nsec;
+#endif
+    return Stamp{int64_t(info.st_mtime), modificationTimeNs, int64_t(info.st_size), uint64_t(info.st_ino)};
+}
+
+bool KeyFileCache::find(std::string const &filePath, Stamp const &stamp, std::string const &password, bytes &secretKey) const
+{
+    wrapper::crypto::SecureBuffer passwordHash(KEYED_HASH_BYTES);
+    m_impl->hashPassword(password, passwordHash.data());
+
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    auto const it = m_impl->entries.find(filePath);
+    if (it == m_impl->entries.end() || !(it->second->stamp == stamp) ||
+        sodium_memcmp(it->second->passwordHash.data(), passwordHash.data(), KEYED_HASH_BYTES) != 0)
+    {
+        return false;
+    }
+
+    Entry const &entry = *it->second;
+    secretKey.assign(entry.secretKey.data(), entry.secretKey.data() + entry.secretKey.size());
+    return true;
+}
+
+void KeyFileCache::insert(std::string const &filePath, Stamp const &stamp, std::string const &password, bytes const &secretKey)
+{
+    std::unique_ptr<Entry> entry(new Entry(stamp, secretKey.size()));
+    m_impl->hashPassword(password, entry->passwordHash.data());
+    std::copy(secretKey.begin(), secretKey.end(), entry->secretKey.data());
+
+    std::lock_guard<std::mutex> lock(m_impl->mutex);
+    m_impl->entries[filePath] = std::move(entry);
+}
+
+KeyFileLoader::KeyFileLoader(unsigned int const numThreads, std::shared_ptr<KeyFileCache> cache) :
+        m_numThreads(numThreads),
+        m_cache(std::move(cache))
+{}
+
+std::vector<KeyFileLoadResult> KeyFileLoader::load(std::vector<KeyFileCredentials> const &files) const
+{
+    std::vector<KeyFileLoadResult> results(files.size());
+
+    util::parallelFor(files.size(), m_numThreads, [&](std::size_t const begin, std::size_t const end)
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            KeyFileCredentials const &file = files[i];
+            try
+            {
+                results[i].keyFile.reset(m_cache ? new KeyFileReader(file.filePath, file.password, *m_cache)
+                                                 : new KeyFileReader(file.filePath, file.password));
+            }
+            catch (std::exception const &e)
+            {
+                results[i].error = e.what();
+            }
+        }
+    });
+
+    return results;
+}
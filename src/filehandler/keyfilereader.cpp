@@ -1,17 +1,19 @@
 #include "filehandler/keyfilereader.h"
+#include "filehandler/keyfileloader.h"
 #include "cryptosignwrapper.h"
 #include "json/json.hpp"
 #include "common.h"
 #include "hex.h"
 
 #include <fstream>
+#include <sodium.h>
 #include <stdexcept>
 
 namespace internal
 {
 bytes deriveSecretKey(EncryptedData const &data, std::string const &password)
 {
-    bytes const derivedKey = wrapper::crypto::scrypt(password, data.kdfParams);
+    bytes derivedKey = wrapper::crypto::scrypt(password, data.kdfParams);
 
     unsigned int const derivedKeyLength = derivedKey.size();
 
@@ -19,39 +21,55 @@ bytes deriveSecretKey(EncryptedData const &data, std::string const &password)
     auto const itKeyHalf = derivedKey.begin() + derivedKeyLength/2;
     auto const itKeyEnd = derivedKey.end();
 
-    bytes const derivedKeyFirstHalf(itKeyBegin, itKeyHalf);
-    bytes const derivedKeySecondHalf(itKeyHalf, itKeyEnd);
+    bytes derivedKeyFirstHalf(itKeyBegin, itKeyHalf);
+    bytes derivedKeySecondHalf(itKeyHalf, itKeyEnd);
 
     std::string computedMac = wrapper::crypto::hmacsha256(derivedKeySecondHalf, data.cipherText);
 
-    if (computedMac != data.mac)
+    bool const validMac = (computedMac == data.mac);
+    bytes secretKey;
+    if (validMac)
+    {
+        secretKey = wrapper::crypto::aes128ctrDecrypt(derivedKeyFirstHalf, data.cipherText, data.iv);
+    }
+
+    // The derived key decrypts the secret key, it must not outlive it in memory either
+    sodium_memzero(derivedKey.data(), derivedKey.size());
+    sodium_memzero(derivedKeyFirstHalf.data(), derivedKeyFirstHalf.size());
+    sodium_memzero(derivedKeySecondHalf.data(), derivedKeySecondHalf.size());
+
+    if (!validMac)
     {
         throw std::runtime_error(ERROR_MSG_MAC);
     }
 
-   return wrapper::crypto::aes128ctrDecrypt(derivedKeyFirstHalf, data.cipherText, data.iv);
+    return secretKey;
 }
 }
 
 KeyFileReader::KeyFileReader(std::string const &filePath, std::string const &password) :
         IFile(filePath, "json"), ISecretKey()
 {
-    try
-    {
-        auto const data = getFileContent();
-
-        util::checkParam(data.version, KEY_FILE_VERSION, ERROR_MSG_KEY_FILE_VERSION);
-        util::checkParam(data.cipher, KEY_FILE_CIPHER_ALGORITHM, ERROR_MSG_KEY_FILE_CIPHER);
-        util::checkParam(data.kdf, KEY_FILE_DERIVATION_FUNCTION, ERROR_MSG_KEY_FILE_DERIVATION_FUNCTION);
+    m_secretKey = decryptSecretKey(password);
+}
 
-        m_secretKey = internal::deriveSecretKey(data, password);
-    }
-    catch (std::exception const &error)
+KeyFileReader::KeyFileReader(std::string const &filePath, std::string const &password, KeyFileCache &cache) :
+        IFile(filePath, "json"), ISecretKey()
+{
+    // Stamped before reading, a modification while decrypting makes the entry stale instead of wrong
+    KeyFileCache::Stamp const stamp = KeyFileCache::stampOf(filePath);
+    if (!cache.find(filePath, stamp, password, m_secretKey))
     {
-        throw;
+        m_secretKey = decryptSecretKey(password);
+        cache.insert(filePath, stamp, password, m_secretKey);
     }
 }
 
+KeyFileReader::~KeyFileReader()
+{
+    sodium_memzero(m_secretKey.data(), m_secretKey.size());
+}
+
 Address KeyFileReader::getAddress() const
 {
     bytes const publicKey = wrapper::crypto::getPublicKey(m_secretKey);
@@ -64,6 +82,17 @@ bytes KeyFileReader::getSeed() const
     return wrapper::crypto::getSeed(m_secretKey);
 }
 
+bytes KeyFileReader::decryptSecretKey(std::string const &password) const
+{
+    auto const data = getFileContent();
+
+    util::checkParam(data.version, KEY_FILE_VERSION, ERROR_MSG_KEY_FILE_VERSION);
+    util::checkParam(data.cipher, KEY_FILE_CIPHER_ALGORITHM, ERROR_MSG_KEY_FILE_CIPHER);
+    util::checkParam(data.kdf, KEY_FILE_DERIVATION_FUNCTION, ERROR_MSG_KEY_FILE_DERIVATION_FUNCTION);
+
+    return internal::deriveSecretKey(data, password);
+}
+
 EncryptedData KeyFileReader::getFileContent() const
 {
     try
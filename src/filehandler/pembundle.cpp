@@ -0,0 +1,197 @@
+#include "filehandler/pembundle.h"
+#include "base64.h"
+#include "errors.h"
+#include "hex.h"
+#include "mapped_file.h"
+#include "parallel.h"
+
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+
+namespace
+{
+char const PEM_BEGIN[] = "-----BEGIN";
+char const PEM_END[] = "-----END";
+std::size_t const PEM_BEGIN_LENGTH = sizeof(PEM_BEGIN) - 1;
+std::size_t const PEM_END_LENGTH = sizeof(PEM_END) - 1;
+
+// Base64 text of one block, between its BEGIN and END lines
+struct Block
+{
+    char const *begin;
+    char const *end;
+};
+
+char const *findText(char const *begin, char const *end, char const *text, std::size_t const length)
+{
+    char const *const found = static_cast<char const *>(memmem(begin, std::size_t(end - begin), text, length));
+    return (found == nullptr) ? end : found;
+}
+
+char const *nextLine(char const *begin, char const *end)
+{
+    char const *const newLine = static_cast<char const *>(std::memchr(begin, '\n', std::size_t(end - begin)));
+    return (newLine == nullptr) ? end : newLine + 1;
+}
+
+std::vector<Block> findBlocks(char const *data, std::size_t const size)
+{
+    char const *const end = data + size;
+    std::vector<Block> blocks;
+
+    char const *position = findText(data, end, PEM_BEGIN, PEM_BEGIN_LENGTH);
+    while (position != end)
+    {
+        char const *const bodyBegin = nextLine(position, end);
+        char const *const bodyEnd = findText(bodyBegin, end, PEM_END, PEM_END_LENGTH);
+        if (bodyEnd == end)
+        {
+            throw std::invalid_argument(ERROR_MSG_PEM_BLOCK + std::to_string(blocks.size()));
+        }
+        blocks.push_back(Block{bodyBegin, bodyEnd});
+
+        position = findText(nextLine(bodyEnd, end), end, PEM_BEGIN, PEM_BEGIN_LENGTH);
+    }
+
+    return blocks;
+}
+
+std::string blockError(std::size_t const index, std::string const &reason)
+{
+    return ERROR_MSG_PEM_BLOCK + std::to_string(index) + ". " + ERROR_MSG_REASON + reason;
+}
+
+// Seed and public key of a block: base64 of the hex of both
+void decodeBlock(Block const &block, std::size_t const index, uint8_t *keyBytes)
+{
+    // Hex of the key bytes, base64 encoded and wrapped over lines
+    std::size_t const hexLength = 2 * (SEED_LENGTH + PUBLIC_KEY_LENGTH);
+    char base64[4 * ((hexLength + 2) / 3) + 1];
+    std::size_t base64Length = 0;
+
+    for (char const *c = block.begin; c != block.end; ++c)
+    {
+        if (*c == '\n' || *c == '\r' || *c == ' ' || *c == '\t')
+        {
+            continue;
+        }
+        if (base64Length == sizeof(base64))
+        {
+            throw std::length_error(blockError(index, ERROR_MSG_KEY_BYTES_SIZE));
+        }
+        base64[base64Length++] = *c;
+    }
+
+    char hex[sizeof(base64)];
+    if (util::base64::decodedLength(base64, base64Length) != hexLength)
+    {
+        throw std::length_error(blockError(index, ERROR_MSG_KEY_BYTES_SIZE));
+    }
+
+    try
+    {
+        util::base64::decode(base64, base64Length, reinterpret_cast<unsigned char *>(hex));
+        util::hexToBytes(hex, hexLength, keyBytes);
+    }
+    catch (std::invalid_argument const &e)
+    {
+        throw std::invalid_argument(blockError(index, e.what()));
+    }
+}
+}
+
+std::size_t const PemBundle::npos = std::size_t(-1);
+
+PemBundle::PemBundle(std::string const &filePath, unsigned int const numThreads) :
+        IFile(filePath, "pem")
+{
+    load(numThreads);
+}
+
+void PemBundle::load(unsigned int const numThreads)
+{
+    util::MappedFile const file(IFile::getFilePath());
+
+    std::vector<Block> const blocks = findBlocks(file.data(), file.size());
+    if (blocks.empty())
+    {
+        throw std::invalid_argument(ERROR_MSG_FILE_EMPTY);
+    }
+
+    // Each chunk stops at its first invalid block. Chunks are contiguous, so the lowest failing index is the first
+    // invalid block of the file, whichever thread failed first.
+    std::size_t firstInvalid = blocks.size();
+    std::exception_ptr firstError = nullptr;
+    std::mutex errorMutex;
+
+    m_keys.resize(blocks.size());
+    util::parallelFor(blocks.size(), numThreads, [&](std::size_t const begin, std::size_t const end)
+    {
+        uint8_t keyBytes[SEED_LENGTH + PUBLIC_KEY_LENGTH];
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            try
+            {
+                decodeBlock(blocks[i], i, keyBytes);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (i < firstInvalid)
+                {
+                    firstInvalid = i;
+                    firstError = std::current_exception();
+                }
+                return;
+            }
+            std::memcpy(m_keys[i].seed, keyBytes, SEED_LENGTH);
+            std::memcpy(m_keys[i].publicKey.data(), keyBytes + SEED_LENGTH, PUBLIC_KEY_LENGTH);
+        }
+    });
+
+    if (firstError != nullptr)
+    {
+        std::rethrow_exception(firstError);
+    }
+
+    // Keeps the first key of duplicated addresses
+    m_index.reserve(m_keys.size());
+    for (std::size_t i = 0; i < m_keys.size(); ++i)
+    {
+        m_index.emplace(m_keys[i].publicKey, i);
+    }
+}
+
+std::size_t PemBundle::size() const
+{
+    return m_keys.size();
+}
+
+Address PemBundle::getAddress(std::size_t const index) const
+{
+    return Address(key(index).publicKey);
+}
+
+bytes PemBundle::getSeed(std::size_t const index) const
+{
+    uint8_t const *const seed = key(index).seed;
+    return bytes(seed, seed + SEED_LENGTH);
+}
+
+Address::PublicKey const &PemBundle::getPublicKey(std::size_t const index) const
+{
+    return key(index).publicKey;
+}
+
+std::size_t PemBundle::find(Address const &address) const
+{
+    auto const it = m_index.find(address.getPublicKey());
+    return (it == m_index.end()) ? npos : it->second;
+}
+
+PemBundle::Key const &PemBundle::key(std::size_t const index) const
+{
+    return m_keys.at(index);
+}
@@ -1,90 +1,459 @@
-#include <utility>
+#include <algorithm>
+#include <stdexcept>
 
-#include "bigint/integer.h"
 #include "internal/biguint.h"
 #include "errors.h"
 
-#define BASE_10 10
-#define BASE_16 16
+#define LIMB_BITS 64U
+// Largest power of 10 which fits in a limb, used to convert to and from decimal in chunks
+#define DECIMAL_CHUNK 10000000000000000000ULL
+#define DECIMAL_CHUNK_DIGITS 19U
 
-BigUInt::BigUInt(uint64_t value)
+namespace
 {
-    std::string valueStr = std::to_string(value);
-    m_value = std::move(valueStr);
+typedef unsigned __int128 uint128_t;
+
+// r = a + b, with na >= nb and r having na limbs. Returns the carry. r may alias a or b.
+uint64_t addLimbs(uint64_t *r, uint64_t const *a, std::size_t na, uint64_t const *b, std::size_t nb)
+{
+    uint64_t carry = 0;
+    std::size_t i = 0;
+
+    for (; i < nb; ++i)
+    {
+        uint128_t const sum = uint128_t(a[i]) + b[i] + carry;
+        r[i] = uint64_t(sum);
+        carry = uint64_t(sum >> LIMB_BITS);
+    }
+    for (; i < na; ++i)
+    {
+        uint128_t const sum = uint128_t(a[i]) + carry;
+        r[i] = uint64_t(sum);
+        carry = uint64_t(sum >> LIMB_BITS);
+    }
+
+    return carry;
+}
+
+// r = a - b, with a >= b and r having na limbs. r may alias a or b.
+void subLimbs(uint64_t *r, uint64_t const *a, std::size_t na, uint64_t const *b, std::size_t nb)
+{
+    uint64_t borrow = 0;
+    std::size_t i = 0;
+
+    for (; i < nb; ++i)
+    {
+        uint64_t const ai = a[i];
+        uint64_t const bi = b[i];
+        r[i] = ai - bi - borrow;
+        borrow = (ai < bi) || (ai - bi < borrow);
+    }
+    for (; i < na; ++i)
+    {
+        uint64_t const ai = a[i];
+        r[i] = ai - borrow;
+        borrow = (ai < borrow);
+    }
 }
 
-BigUInt::BigUInt(std::string value)
+// r = a * b, with r having na + nb zeroed limbs. r must not alias a or b.
+void mulLimbs(uint64_t *r, uint64_t const *a, std::size_t na, uint64_t const *b, std::size_t nb)
 {
-    try
+    for (std::size_t i = 0; i < na; ++i)
     {
-        integer number(value, BASE_10);
-        if (number.sign() == integer::NEGATIVE)
+        uint64_t carry = 0;
+        for (std::size_t j = 0; j < nb; ++j)
         {
-            throw std::invalid_argument(ERROR_MSG_NEGATIVE_VALUE);
+            uint128_t const product = uint128_t(a[i]) * b[j] + r[i + j] + carry;
+            r[i + j] = uint64_t(product);
+            carry = uint64_t(product >> LIMB_BITS);
         }
+        r[i + nb] = carry;
     }
-    catch (const std::exception &e)
+}
+
+// q = a / d, returns a % d. q has na limbs and may alias a.
+uint64_t divLimbsBySingle(uint64_t *q, uint64_t const *a, std::size_t na, uint64_t d)
+{
+    uint64_t rem = 0;
+
+    for (std::size_t i = na; i-- > 0;)
     {
-        throw std::invalid_argument(ERROR_MSG_VALUE + value + ", reason: " + e.what());
+        uint128_t const num = (uint128_t(rem) << LIMB_BITS) | a[i];
+        q[i] = uint64_t(num / d);
+        rem = uint64_t(num % d);
     }
 
-    m_value = (std::move(value));
+    return rem;
 }
 
-std::string BigUInt::getHexValue() const
+int countLeadingZeros(uint64_t value)
+{
+    return __builtin_clzll(value);
+}
+
+// Knuth, TAOCP vol. 2, algorithm D. Requires na >= nb >= 2 and b[nb - 1] != 0.
+// q has na - nb + 1 limbs, r has nb limbs.
+void divLimbs(uint64_t *q, uint64_t *r, uint64_t const *a, std::size_t na, uint64_t const *b, std::size_t nb)
+{
+    int const shift = countLeadingZeros(b[nb - 1]);
+
+    // Normalize so that the top limb of the divisor has its highest bit set
+    std::vector<uint64_t> bn(nb);
+    std::vector<uint64_t> an(na + 1);
+    for (std::size_t i = nb - 1; i > 0; --i)
+    {
+        bn[i] = (b[i] << shift) | (shift ? (b[i - 1] >> (LIMB_BITS - shift)) : 0);
+    }
+    bn[0] = b[0] << shift;
+
+    an[na] = shift ? (a[na - 1] >> (LIMB_BITS - shift)) : 0;
+    for (std::size_t i = na - 1; i > 0; --i)
+    {
+        an[i] = (a[i] << shift) | (shift ? (a[i - 1] >> (LIMB_BITS - shift)) : 0);
+    }
+    an[0] = a[0] << shift;
+
+    uint128_t const base = uint128_t(1) << LIMB_BITS;
+
+    for (std::size_t j = na - nb + 1; j-- > 0;)
+    {
+        uint128_t const num = (uint128_t(an[j + nb]) << LIMB_BITS) | an[j + nb - 1];
+        uint128_t qhat = num / bn[nb - 1];
+        uint128_t rhat = num % bn[nb - 1];
+
+        while (qhat >= base || qhat * bn[nb - 2] > ((rhat << LIMB_BITS) | an[j + nb - 2]))
+        {
+            --qhat;
+            rhat += bn[nb - 1];
+            if (rhat >= base)
+            {
+                break;
+            }
+        }
+
+        // Multiply and subtract
+        uint64_t carry = 0;
+        uint64_t borrow = 0;
+        for (std::size_t i = 0; i < nb; ++i)
+        {
+            uint128_t const product = qhat * bn[i] + carry;
+            carry = uint64_t(product >> LIMB_BITS);
+
+            uint64_t const lo = uint64_t(product);
+            uint64_t const ai = an[i + j];
+            an[i + j] = ai - lo - borrow;
+            borrow = (ai < lo) || (ai - lo < borrow);
+        }
+        uint128_t const subtrahend = uint128_t(carry) + borrow;
+        bool const negative = an[j + nb] < subtrahend;
+        an[j + nb] = uint64_t(an[j + nb] - subtrahend);
+
+        if (negative)
+        {
+            // qhat was one too large, add the divisor back
+            --qhat;
+            uint64_t const addCarry = addLimbs(&an[j], &an[j], nb, bn.data(), nb);
+            an[j + nb] += addCarry;
+        }
+
+        q[j] = uint64_t(qhat);
+    }
+
+    // Unnormalize the remainder
+    for (std::size_t i = 0; i < nb - 1; ++i)
+    {
+        r[i] = (an[i] >> shift) | (shift ? (an[i + 1] << (LIMB_BITS - shift)) : 0);
+    }
+    r[nb - 1] = an[nb - 1] >> shift;
+}
+}
+
+BigUInt::BigUInt() :
+        m_size(0),
+        m_inline(),
+        m_heap()
+{}
+
+BigUInt::BigUInt(BigUInt &&other) noexcept :
+        m_size(other.m_size),
+        m_inline(other.m_inline),
+        m_heap(std::move(other.m_heap))
+{
+    other.m_size = 0;
+    other.m_heap.clear();
+}
+
+BigUInt &BigUInt::operator=(BigUInt &&rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        m_size = rhs.m_size;
+        m_inline = rhs.m_inline;
+        m_heap = std::move(rhs.m_heap);
+        rhs.m_size = 0;
+        rhs.m_heap.clear();
+    }
+    return *this;
+}
+
+BigUInt::BigUInt(uint64_t value) :
+        BigUInt()
+{
+    if (value != 0)
+    {
+        m_size = 1;
+        m_inline[0] = value;
+    }
+}
+
+BigUInt::BigUInt(std::string const &value) :
+        BigUInt()
+{
+    if (!value.empty() && value[0] == '-')
+    {
+        throw std::invalid_argument(ERROR_MSG_VALUE + value + ", reason: " + ERROR_MSG_NEGATIVE_VALUE);
+    }
+
+    for (char const c: value)
+    {
+        if (c < '0' || c > '9')
+        {
+            throw std::invalid_argument(ERROR_MSG_VALUE + value + ", reason: " + ERROR_MSG_NOT_A_DIGIT + "'" + c + "'");
+        }
+    }
+
+    // Each chunk of up to 19 digits is folded in with a single multiply-add pass over the limbs
+    std::size_t pos = 0;
+    while (pos < value.size())
+    {
+        std::size_t const numDigits = std::min<std::size_t>(DECIMAL_CHUNK_DIGITS, value.size() - pos);
+        uint64_t chunk = 0;
+        uint64_t multiplier = 1;
+        for (std::size_t i = 0; i < numDigits; ++i)
+        {
+            chunk = chunk * 10 + uint64_t(value[pos + i] - '0');
+            multiplier *= 10;
+        }
+        pos += numDigits;
+
+        uint64_t carry = chunk;
+        uint64_t *data = limbs();
+        for (std::size_t i = 0; i < m_size; ++i)
+        {
+            uint128_t const product = uint128_t(data[i]) * multiplier + carry;
+            data[i] = uint64_t(product);
+            carry = uint64_t(product >> LIMB_BITS);
+        }
+        if (carry != 0)
+        {
+            resize(m_size + 1);
+            limbs()[m_size - 1] = carry;
+        }
+    }
+}
+
+uint64_t const *BigUInt::limbs() const
+{
+    return (m_size > BIG_UINT_INLINE_LIMBS) ? m_heap.data() : m_inline.data();
+}
+
+uint64_t *BigUInt::limbs()
+{
+    return (m_size > BIG_UINT_INLINE_LIMBS) ? m_heap.data() : m_inline.data();
+}
+
+void BigUInt::resize(std::size_t const size)
+{
+    bool const wasInline = m_size <= BIG_UINT_INLINE_LIMBS;
+    bool const isInline = size <= BIG_UINT_INLINE_LIMBS;
+
+    if (wasInline && isInline)
+    {
+        std::fill(m_inline.begin() + std::min(m_size, size), m_inline.end(), 0);
+    }
+    else if (wasInline)
+    {
+        m_heap.assign(size, 0);
+        std::copy(m_inline.begin(), m_inline.begin() + m_size, m_heap.begin());
+        std::fill(m_inline.begin(), m_inline.end(), 0);
+    }
+    else if (isInline)
+    {
+        std::copy(m_heap.begin(), m_heap.begin() + size, m_inline.begin());
+        std::fill(m_inline.begin() + size, m_inline.end(), 0);
+        m_heap.clear();
+    }
+    else
+    {
+        m_heap.resize(size, 0);
+    }
+
+    m_size = size;
+}
+
+void BigUInt::trim()
+{
+    std::size_t size = m_size;
+    uint64_t const *data = limbs();
+
+    while (size > 0 && data[size - 1] == 0)
+    {
+        --size;
+    }
+
+    if (size != m_size)
+    {
+        resize(size);
+    }
+}
+
+int BigUInt::compare(BigUInt const &rhs) const
 {
-    std::string ret;
+    if (m_size != rhs.m_size)
+    {
+        return (m_size < rhs.m_size) ? -1 : 1;
+    }
 
-    try
+    uint64_t const *a = limbs();
+    uint64_t const *b = rhs.limbs();
+    for (std::size_t i = m_size; i-- > 0;)
     {
-        integer number(m_value, BASE_10);
-        ret = number.str(BASE_16);
+        if (a[i] != b[i])
+        {
+            return (a[i] < b[i]) ? -1 : 1;
+        }
     }
-    catch (const std::exception &e)
+
+    return 0;
+}
+
+std::string BigUInt::getHexValue() const
+{
+    static char const hexDigits[] = "0123456789abcdef";
+
+    if (m_size == 0)
     {
-        throw std::invalid_argument(
-                ERROR_MSG_CANNOT_CONVERT_TO_BASE + std::to_string(BASE_16) +
-                ", value: " + m_value +
-                ", reason: " + e.what());
+        return "00";
     }
 
-    if (ret.size() % 2 != 0)
+    uint64_t const *data = limbs();
+    std::size_t const topDigits = (LIMB_BITS - countLeadingZeros(data[m_size - 1]) + 3) / 4;
+    std::size_t const numDigits = topDigits + (m_size - 1) * 16;
+    bool const pad = (numDigits % 2) != 0;
+
+    std::string ret(numDigits + (pad ? 1 : 0), '0');
+    auto out = ret.rbegin();
+    for (std::size_t i = 0; i < m_size; ++i)
     {
-        ret.insert(ret.begin(), '0');
+        uint64_t limb = data[i];
+        std::size_t const digits = (i + 1 == m_size) ? topDigits : 16;
+        for (std::size_t d = 0; d < digits; ++d)
+        {
+            *out++ = hexDigits[limb & 0xf];
+            limb >>= 4;
+        }
     }
 
     return ret;
 }
 
-const std::string &BigUInt::getValue() const
+std::string BigUInt::getValue() const
 {
-    return m_value;
+    if (m_size == 0)
+    {
+        return "0";
+    }
+
+    // Split into base 10^19 chunks, least significant first
+    std::vector<uint64_t> quotient(limbs(), limbs() + m_size);
+    std::vector<uint64_t> chunks;
+    chunks.reserve(m_size + 1);
+
+    std::size_t size = m_size;
+    while (size > 0)
+    {
+        chunks.push_back(divLimbsBySingle(quotient.data(), quotient.data(), size, DECIMAL_CHUNK));
+        while (size > 0 && quotient[size - 1] == 0)
+        {
+            --size;
+        }
+    }
+
+    std::string ret = std::to_string(chunks.back());
+    ret.reserve(ret.size() + (chunks.size() - 1) * DECIMAL_CHUNK_DIGITS);
+    for (std::size_t i = chunks.size() - 1; i-- > 0;)
+    {
+        char digits[DECIMAL_CHUNK_DIGITS];
+        uint64_t chunk = chunks[i];
+        for (std::size_t d = DECIMAL_CHUNK_DIGITS; d-- > 0;)
+        {
+            digits[d] = char('0' + chunk % 10);
+            chunk /= 10;
+        }
+        ret.append(digits, DECIMAL_CHUNK_DIGITS);
+    }
+
+    return ret;
 }
 
 BigUInt BigUInt::operator*(const BigUInt &rhs) const
 {
-    integer v1(m_value, BASE_10);
-    integer v2(rhs.getValue(), BASE_10);
-    std::string ret = (v1 * v2).str();
+    BigUInt result;
+    if (m_size == 0 || rhs.m_size == 0)
+    {
+        return result;
+    }
+
+    result.resize(m_size + rhs.m_size);
+    mulLimbs(result.limbs(), limbs(), m_size, rhs.limbs(), rhs.m_size);
+    result.trim();
 
-    return BigUInt(ret);
+    return result;
 }
 
 bool BigUInt::operator==(const BigUInt &rhs) const
 {
-    return this->m_value == rhs.m_value;
+    return compare(rhs) == 0;
+}
+
+bool BigUInt::operator!=(const BigUInt &rhs) const
+{
+    return compare(rhs) != 0;
 }
 
 std::pair<BigUInt, BigUInt> BigUInt::divmod(const BigUInt &rhs) const
 {
-    integer v1(m_value, BASE_10);
-    integer v2(rhs.getValue(), BASE_10);
-    std::pair<integer, integer> res = v1.divmod(v1, v2);
+    if (rhs.m_size == 0)
+    {
+        throw std::invalid_argument(ERROR_MSG_DIVISION_BY_ZERO);
+    }
+
+    if (compare(rhs) < 0)
+    {
+        return {BigUInt(), *this};
+    }
+
+    BigUInt quotient;
+    BigUInt remainder;
 
-    BigUInt retV1 = BigUInt(res.first.str());
-    BigUInt retV2 = BigUInt(res.second.str());
+    if (rhs.m_size == 1)
+    {
+        quotient.resize(m_size);
+        uint64_t const rem = divLimbsBySingle(quotient.limbs(), limbs(), m_size, rhs.limbs()[0]);
+        quotient.trim();
+        remainder = BigUInt(rem);
+    }
+    else
+    {
+        quotient.resize(m_size - rhs.m_size + 1);
+        remainder.resize(rhs.m_size);
+        divLimbs(quotient.limbs(), remainder.limbs(), limbs(), m_size, rhs.limbs(), rhs.m_size);
+        quotient.trim();
+        remainder.trim();
+    }
 
-    return {retV1, retV2};
+    return {quotient, remainder};
 }
 
 BigUInt BigUInt::operator/(const BigUInt &rhs) const
@@ -94,34 +463,92 @@ BigUInt BigUInt::operator/(const BigUInt &rhs) const
 
 bool BigUInt::operator>(const BigUInt &rhs) const
 {
-    integer v1(m_value, BASE_10);
-    integer v2(rhs.getValue(), BASE_10);
-
-    return v1 > v2;
+    return compare(rhs) > 0;
 }
 
 bool BigUInt::operator<(const BigUInt &rhs) const
 {
-    integer v1(m_value, BASE_10);
-    integer v2(rhs.getValue(), BASE_10);
-
-    return v1 < v2;
+    return compare(rhs) < 0;
 }
 
 BigUInt BigUInt::operator-(const BigUInt &rhs) const
 {
-    integer v1(m_value, BASE_10);
-    integer v2(rhs.getValue(), BASE_10);
-    integer res = v1 - v2;
+    if (compare(rhs) < 0)
+    {
+        throw std::invalid_argument(ERROR_MSG_VALUE + getValue() + " - " + rhs.getValue() + ", reason: " + ERROR_MSG_NEGATIVE_VALUE);
+    }
+
+    BigUInt result;
+    result.resize(m_size);
+    subLimbs(result.limbs(), limbs(), m_size, rhs.limbs(), rhs.m_size);
+    result.trim();
 
-    return BigUInt(res.str());
+    return result;
 }
 
 BigUInt BigUInt::operator+(const BigUInt &rhs) const
 {
-    integer v1(m_value, BASE_10);
-    integer v2(rhs.getValue(), BASE_10);
-    integer res = v1 + v2;
+    BigUInt const &longer = (m_size >= rhs.m_size) ? *this : rhs;
+    BigUInt const &shorter = (m_size >= rhs.m_size) ? rhs : *this;
+
+    BigUInt result;
+    result.resize(longer.m_size + 1);
+    uint64_t const carry = addLimbs(result.limbs(), longer.limbs(), longer.m_size, shorter.limbs(), shorter.m_size);
+    result.limbs()[longer.m_size] = carry;
+    result.trim();
+
+    return result;
+}
+
+BigUInt &BigUInt::operator+=(const BigUInt &rhs)
+{
+    // rhs may be this, so its size is read before resizing
+    std::size_t const rhsSize = rhs.m_size;
+    std::size_t const size = std::max(m_size, rhsSize);
+
+    resize(size);
+    uint64_t const carry = addLimbs(limbs(), limbs(), size, rhs.limbs(), rhsSize);
+    if (carry != 0)
+    {
+        resize(size + 1);
+        limbs()[size] = carry;
+    }
+
+    return *this;
+}
+
+BigUInt &BigUInt::operator-=(const BigUInt &rhs)
+{
+    if (compare(rhs) < 0)
+    {
+        throw std::invalid_argument(ERROR_MSG_VALUE + getValue() + " - " + rhs.getValue() + ", reason: " + ERROR_MSG_NEGATIVE_VALUE);
+    }
+
+    subLimbs(limbs(), limbs(), m_size, rhs.limbs(), rhs.m_size);
+    trim();
+
+    return *this;
+}
+
+BigUInt &BigUInt::operator*=(const BigUInt &rhs)
+{
+    // Products of values up to 256 bits are built inline, so moving the result back does not allocate
+    *this = *this * rhs;
+
+    return *this;
+}
+
+BigUInt &BigUInt::operator/=(const BigUInt &rhs)
+{
+    if (rhs.m_size == 1)
+    {
+        divLimbsBySingle(limbs(), limbs(), m_size, rhs.limbs()[0]);
+        trim();
+    }
+    else
+    {
+        *this = divmod(rhs).first;
+    }
 
-    return BigUInt(res.str());
+    return *this;
 }
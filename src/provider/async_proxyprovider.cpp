@@ -0,0 +1,98 @@
+#include "provider/async_proxyprovider.h"
+#include "thread_pool.h"
+#include "callbacks.h"
+
+namespace
+{
+template<typename T, typename Request>
+std::future<T> enqueue(util::ThreadPool &threadPool, Request request)
+{
+    auto const task = std::make_shared<std::packaged_task<T()>>(std::move(request));
+    std::future<T> result = task->get_future();
+
+    threadPool.submit([task]() { (*task)(); });
+
+    return result;
+}
+
+template<typename T, typename Request>
+void enqueue(util::ThreadPool &threadPool,
+             Request request,
+             AsyncProxyProvider::SuccessCallback<T> onSuccess,
+             AsyncProxyProvider::ErrorCallback onError)
+{
+    threadPool.submit([request, onSuccess, onError]()
+                      {
+                          util::deliverResult<T>(request,
+                                                 [&onSuccess](T result) { if (onSuccess) onSuccess(std::move(result)); },
+                                                 [&onError](std::exception_ptr error) { if (onError) onError(error); });
+                      });
+}
+}
+
+AsyncProxyProvider::AsyncProxyProvider(std::string url, ProxyProviderConfig const &config, std::size_t const maxInFlight) :
+        m_proxy(std::move(url), config),
+        m_threadPool(new util::ThreadPool(unsigned(config.maxConnections), maxInFlight))
+{}
+
+AsyncProxyProvider::~AsyncProxyProvider() = default;
+
+std::future<Account> AsyncProxyProvider::getAccount(Address const &address)
+{
+    return enqueue<Account>(*m_threadPool, [this, address]() { return m_proxy.getAccount(address); });
+}
+
+void AsyncProxyProvider::getAccount(Address const &address, SuccessCallback<Account> onSuccess, ErrorCallback onError)
+{
+    enqueue<Account>(*m_threadPool, [this, address]() { return m_proxy.getAccount(address); },
+                     std::move(onSuccess), std::move(onError));
+}
+
+std::future<std::string> AsyncProxyProvider::send(Transaction const &transaction)
+{
+    return enqueue<std::string>(*m_threadPool, [this, transaction]() { return m_proxy.send(transaction); });
+}
+
+void AsyncProxyProvider::send(Transaction const &transaction, SuccessCallback<std::string> onSuccess, ErrorCallback onError)
+{
+    enqueue<std::string>(*m_threadPool, [this, transaction]() { return m_proxy.send(transaction); },
+                         std::move(onSuccess), std::move(onError));
+}
+
+std::future<TransactionStatus> AsyncProxyProvider::getTransactionStatus(std::string const &txHash)
+{
+    return enqueue<TransactionStatus>(*m_threadPool, [this, txHash]() { return m_proxy.getTransactionStatus(txHash); });
+}
+
+void AsyncProxyProvider::getTransactionStatus(std::string const &txHash, SuccessCallback<TransactionStatus> onSuccess, ErrorCallback onError)
+{
+    enqueue<TransactionStatus>(*m_threadPool, [this, txHash]() { return m_proxy.getTransactionStatus(txHash); },
+                               std::move(onSuccess), std::move(onError));
+}
+
+std::future<BigUInt> AsyncProxyProvider::getESDTBalance(Address const &address, std::string const &token)
+{
+    return enqueue<BigUInt>(*m_threadPool, [this, address, token]() { return m_proxy.getESDTBalance(address, token); });
+}
+
+void AsyncProxyProvider::getESDTBalance(Address const &address, std::string const &token, SuccessCallback<BigUInt> onSuccess, ErrorCallback onError)
+{
+    enqueue<BigUInt>(*m_threadPool, [this, address, token]() { return m_proxy.getESDTBalance(address, token); },
+                     std::move(onSuccess), std::move(onError));
+}
+
+std::future<NetworkConfig> AsyncProxyProvider::getNetworkConfig()
+{
+    return enqueue<NetworkConfig>(*m_threadPool, [this]() { return m_proxy.getNetworkConfig(); });
+}
+
+void AsyncProxyProvider::getNetworkConfig(SuccessCallback<NetworkConfig> onSuccess, ErrorCallback onError)
+{
+    enqueue<NetworkConfig>(*m_threadPool, [this]() { return m_proxy.getNetworkConfig(); },
+                           std::move(onSuccess), std::move(onError));
+}
+
+std::size_t AsyncProxyProvider::numInFlight() const
+{
+    return m_threadPool->numPending();
+}
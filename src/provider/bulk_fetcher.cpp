@@ -0,0 +1,128 @@
+#include "provider/bulk_fetcher.h"
+#include "httpresilience.h"
+#include "response_reader.h"
+#include "backoff.h"
+#include "rate_limiter.h"
+#include "thread_pool.h"
+#include "callbacks.h"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace
+{
+// Signals the caller of a bulk fetch once all its workers are done
+class WorkersDone
+{
+public:
+    explicit WorkersDone(std::size_t const numWorkers) :
+            m_numRunning(numWorkers)
+    {}
+
+    void done()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_numRunning == 0)
+        {
+            m_allDone.notify_all();
+        }
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_allDone.wait(lock, [this]() { return m_numRunning == 0; });
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_allDone;
+    std::size_t m_numRunning;
+};
+}
+
+BulkProxyFetcher::BulkProxyFetcher(std::string url, ProxyProviderConfig const &proxyConfig, BulkFetchConfig const &config) :
+        m_config(config),
+        m_pool(std::make_shared<wrapper::http::ClientPool>(
+                std::move(url), config.maxConcurrency, proxyConfig.idleTimeout,
+                wrapper::http::Timeouts{proxyConfig.connectionTimeout, proxyConfig.readTimeout, proxyConfig.writeTimeout})),
+        m_rateLimiter(new util::RateLimiter(config.maxRequestsPerSecond, config.burst)),
+        m_numRetries(0),
+        m_threadPool(new util::ThreadPool(unsigned(std::max<std::size_t>(config.maxConcurrency, 1U)), std::max<std::size_t>(config.maxConcurrency, 1U)))
+{}
+
+BulkProxyFetcher::~BulkProxyFetcher() = default;
+
+template<typename T, typename Read>
+void BulkProxyFetcher::fetchAll(std::vector<Address> const &addresses, std::string const &pathSuffix, Read read,
+                                ResultCallback<T> const &onResult, ErrorCallback const &onError)
+{
+    // Workers take the next address as soon as they are done with the previous one, so a slow response only
+    // holds up its own worker
+    std::size_t const numWorkers = std::min(std::max<std::size_t>(m_config.maxConcurrency, 1U), addresses.size());
+    std::atomic<std::size_t> next(0);
+    WorkersDone workersDone(numWorkers);
+
+    for (std::size_t w = 0; w < numWorkers; ++w)
+    {
+        m_threadPool->submit([&]()
+                             {
+                                 for (std::size_t i = next++; i < addresses.size(); i = next++)
+                                 {
+                                     Address const &address = addresses[i];
+                                     util::deliverResult<T>(
+                                             [&]() { return read(fetch("/address/" + address.getBech32Address() + pathSuffix), address); },
+                                             [&](T result) { if (onResult) onResult(i, std::move(result)); },
+                                             [&](std::exception_ptr error) { if (onError) onError(i, error); });
+                                 }
+                                 workersDone.done();
+                             });
+    }
+
+    workersDone.wait();
+}
+
+std::string BulkProxyFetcher::fetch(std::string const &path)
+{
+    static thread_local std::mt19937 rng(std::random_device{}());
+    util::Backoff const backoff(m_config.initialBackoff, m_config.maxBackoff);
+
+    for (unsigned int retry = 0;; ++retry)
+    {
+        m_rateLimiter->acquire();
+        wrapper::http::Result result = m_pool->get(path);
+
+        if (!wrapper::http::isTransientFailure(result) || retry >= m_config.maxRetries)
+        {
+            if (result.error)
+            {
+                throw std::runtime_error(result.statusMessage);
+            }
+            return std::move(result.body);
+        }
+
+        ++m_numRetries;
+        std::this_thread::sleep_for(backoff.delay(retry, rng));
+    }
+}
+
+void BulkProxyFetcher::getAccounts(std::vector<Address> const &addresses, ResultCallback<Account> onAccount, ErrorCallback onError)
+{
+    fetchAll<Account>(addresses, "",
+                      [](std::string const &body, Address const &address) { return internal::readAccount(body, address); },
+                      onAccount, onError);
+}
+
+void BulkProxyFetcher::getAllESDTBalances(std::vector<Address> const &addresses,
+                                          ResultCallback<std::map<std::string, BigUInt>> onBalances,
+                                          ErrorCallback onError)
+{
+    fetchAll<std::map<std::string, BigUInt>>(addresses, "/esdt",
+                                             [](std::string const &body, Address const &) { return internal::readAllESDTBalances(body); },
+                                             onBalances, onError);
+}
+
+uint64_t BulkProxyFetcher::numRetries() const
+{
+    return m_numRetries;
+}
@@ -0,0 +1,165 @@
+#include "provider/nonce_manager.h"
+
+NonceManager::Sender::Sender(uint64_t const nonce) :
+        m_next(nonce),
+        m_numGaps(0),
+        m_confirmedFloor(nonce)
+{}
+
+uint64_t NonceManager::Sender::acquire()
+{
+    if (m_numGaps > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_gaps.empty())
+        {
+            uint64_t const nonce = *m_gaps.begin();
+            m_gaps.erase(m_gaps.begin());
+            m_numGaps = m_gaps.size();
+            return nonce;
+        }
+    }
+
+    return m_next.fetch_add(1);
+}
+
+void NonceManager::Sender::confirm(uint64_t const nonce)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (nonce < m_confirmedFloor || nonce >= m_next)
+    {
+        return; // Predates the last sync
+    }
+
+    m_gaps.erase(nonce);
+    m_numGaps = m_gaps.size();
+    m_confirmed.insert(nonce);
+    while (!m_confirmed.empty() && *m_confirmed.begin() == m_confirmedFloor)
+    {
+        m_confirmed.erase(m_confirmed.begin());
+        ++m_confirmedFloor;
+    }
+}
+
+void NonceManager::Sender::release(uint64_t const nonce)
+{
+    // Nothing was acquired after it, so the latest nonce is simply handed out again
+    uint64_t expected = nonce + 1;
+    if (m_next.compare_exchange_strong(expected, nonce))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (nonce >= m_confirmedFloor && nonce < m_next && m_confirmed.count(nonce) == 0)
+    {
+        m_gaps.insert(nonce);
+        m_numGaps = m_gaps.size();
+    }
+}
+
+std::vector<uint64_t> NonceManager::Sender::getOutstanding() const
+{
+    std::vector<uint64_t> outstanding;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint64_t const next = m_next;
+    for (uint64_t nonce = m_confirmedFloor; nonce < next; ++nonce)
+    {
+        if (m_confirmed.count(nonce) == 0 && m_gaps.count(nonce) == 0)
+        {
+            outstanding.push_back(nonce);
+        }
+    }
+
+    return outstanding;
+}
+
+std::vector<uint64_t> NonceManager::Sender::getGaps() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return std::vector<uint64_t>(m_gaps.begin(), m_gaps.end());
+}
+
+void NonceManager::Sender::reset(uint64_t const nonce)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_next = nonce;
+    m_confirmedFloor = nonce;
+    m_confirmed.clear();
+    m_gaps.clear();
+    m_numGaps = 0;
+}
+
+NonceManager::NonceManager(ProxyProvider proxy) :
+        m_proxy(std::move(proxy))
+{}
+
+NonceManager::~NonceManager() = default;
+
+NonceManager::Sender &NonceManager::sender(Address const &sender)
+{
+    Sender *const nonces = findSender(sender);
+    if (nonces != nullptr)
+    {
+        return *nonces;
+    }
+
+    // Fetched without holding the lock, if another thread registered the sender meanwhile its state wins
+    uint64_t const nonce = m_proxy.getAccount(sender).getNonce();
+
+    std::unique_lock<std::shared_timed_mutex> lock(m_sendersMutex);
+    auto const it = m_senders.emplace(sender, std::unique_ptr<Sender>(new Sender(nonce))).first;
+    return *it->second;
+}
+
+uint64_t NonceManager::acquire(Address const &sender)
+{
+    return this->sender(sender).acquire();
+}
+
+void NonceManager::confirm(Address const &sender, uint64_t const nonce)
+{
+    Sender *const nonces = findSender(sender);
+    if (nonces != nullptr)
+    {
+        nonces->confirm(nonce);
+    }
+}
+
+void NonceManager::release(Address const &sender, uint64_t const nonce)
+{
+    Sender *const nonces = findSender(sender);
+    if (nonces != nullptr)
+    {
+        nonces->release(nonce);
+    }
+}
+
+uint64_t NonceManager::resync(Address const &sender)
+{
+    uint64_t const nonce = m_proxy.getAccount(sender).getNonce();
+
+    this->sender(sender).reset(nonce);
+
+    return nonce;
+}
+
+std::vector<uint64_t> NonceManager::getOutstanding(Address const &sender) const
+{
+    Sender *const nonces = findSender(sender);
+    return (nonces == nullptr) ? std::vector<uint64_t>() : nonces->getOutstanding();
+}
+
+std::vector<uint64_t> NonceManager::getGaps(Address const &sender) const
+{
+    Sender *const nonces = findSender(sender);
+    return (nonces == nullptr) ? std::vector<uint64_t>() : nonces->getGaps();
+}
+
+NonceManager::Sender *NonceManager::findSender(Address const &sender) const
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_sendersMutex);
+    auto const it = m_senders.find(sender);
+    return (it == m_senders.end()) ? nullptr : it->second.get();
+}
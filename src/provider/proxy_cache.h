@@ -0,0 +1,187 @@
+#ifndef ERD_PROXY_CACHE_H
+#define ERD_PROXY_CACHE_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "provider/proxyprovider.h"
+#include "../utils/thread_pool.h"
+
+// Maximum number of background refreshes queued or running, further stale reads skip the refresh
+#define PROXY_CACHE_MAX_PENDING_REFRESHES 256U
+
+namespace internal
+{
+struct CacheCounters
+{
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> staleHits{0};
+    std::atomic<uint64_t> misses{0};
+};
+
+// Values younger than ttl are returned as is. Values younger than ttl + staleWhileRevalidate are returned as well,
+// but trigger a refresh on the refresher pool. Older or missing values are fetched in the calling thread.
+// A zero ttl disables caching.
+template<typename Value>
+class TtlCache
+{
+public:
+    typedef std::function<Value()> Fetch;
+
+    TtlCache(std::chrono::milliseconds const ttl,
+             std::chrono::milliseconds const staleWhileRevalidate,
+             CacheCounters &counters,
+             util::ThreadPool &refresher) :
+            m_ttl(ttl),
+            m_staleWhileRevalidate(staleWhileRevalidate),
+            m_counters(counters),
+            m_refresher(refresher)
+    {}
+
+    Value get(std::string const &key, Fetch const &fetch)
+    {
+        if (m_ttl.count() <= 0)
+        {
+            return fetch();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto const it = m_entries.find(key);
+            if (it != m_entries.end())
+            {
+                Entry &entry = it->second;
+                Clock::duration const age = Clock::now() - entry.fetchedAt;
+                if (age < m_ttl)
+                {
+                    ++m_counters.hits;
+                    return entry.value;
+                }
+                if (age < m_ttl + m_staleWhileRevalidate)
+                {
+                    ++m_counters.staleHits;
+                    if (!entry.refreshing)
+                    {
+                        entry.refreshing = m_refresher.trySubmit([this, key, fetch]() { refresh(key, fetch); });
+                    }
+                    return entry.value;
+                }
+            }
+        }
+
+        // Concurrent misses of the same key each fetch, the last one stored wins
+        ++m_counters.misses;
+        Value value = fetch();
+        store(key, value);
+        return value;
+    }
+
+    void invalidate(std::string const &key)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.erase(key);
+    }
+
+    void invalidatePrefix(std::string const &prefix)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.lower_bound(prefix);
+        while (it != m_entries.end() && it->first.compare(0, prefix.size(), prefix) == 0)
+        {
+            it = m_entries.erase(it);
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+    }
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Entry
+    {
+        Value value;
+        Clock::time_point fetchedAt;
+        bool refreshing;
+    };
+
+    void store(std::string const &key, Value const &value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto const it = m_entries.find(key);
+        if (it == m_entries.end())
+        {
+            m_entries.emplace(key, Entry{value, Clock::now(), false});
+        }
+        else
+        {
+            it->second = Entry{value, Clock::now(), false};
+        }
+    }
+
+    void refresh(std::string const &key, Fetch const &fetch)
+    {
+        try
+        {
+            Value value = fetch();
+
+            // An entry invalidated while refreshing stays invalidated
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto const it = m_entries.find(key);
+            if (it != m_entries.end() && it->second.refreshing)
+            {
+                it->second = Entry{value, Clock::now(), false};
+            }
+        }
+        catch (...)
+        {
+            // The stale value keeps being served until it expires, a later read retries the refresh
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto const it = m_entries.find(key);
+            if (it != m_entries.end())
+            {
+                it->second.refreshing = false;
+            }
+        }
+    }
+
+    std::chrono::milliseconds const m_ttl;
+    std::chrono::milliseconds const m_staleWhileRevalidate;
+    CacheCounters &m_counters;
+    util::ThreadPool &m_refresher;
+
+    std::mutex m_mutex;
+    std::map<std::string, Entry> m_entries;
+};
+
+// Shared by all copies of a ProxyProvider
+class ProxyCache
+{
+public:
+    explicit ProxyCache(ProxyProviderCacheConfig const &config) :
+            networkConfig(config.networkConfigTtl, config.staleWhileRevalidate, counters, m_refresher),
+            accounts(config.accountTtl, config.staleWhileRevalidate, counters, m_refresher),
+            esdtBalances(config.esdtBalanceTtl, config.staleWhileRevalidate, counters, m_refresher),
+            m_refresher(1, PROXY_CACHE_MAX_PENDING_REFRESHES)
+    {}
+
+    CacheCounters counters;
+    TtlCache<NetworkConfig> networkConfig;
+    TtlCache<Account> accounts;
+    // Keyed by "<bech32 address>/<token>"
+    TtlCache<BigUInt> esdtBalances;
+
+private:
+    // Declared last so that pending refreshes complete before the caches they update are destroyed
+    util::ThreadPool m_refresher;
+};
+}
+
+#endif //ERD_PROXY_CACHE_H
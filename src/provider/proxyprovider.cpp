@@ -1,135 +1,238 @@
 #include "provider/proxyprovider.h"
-#include "apiresponse.h"
-#include "httpwrapper.h"
+#include "httpresilience.h"
+#include "proxy_cache.h"
+#include "response_reader.h"
+#include "../transaction/transaction_serializer.h"
 
 namespace internal
 {
-ErdGenericApiResponse parse(wrapper::http::Result const &res)
+std::string const &responseBody(wrapper::http::Result const &res)
 {
     if (res.error)
     {
         throw std::runtime_error(res.statusMessage);
     }
 
-    return ErdGenericApiResponse(res.body);
+    return res.body;
 }
 
-nlohmann::json getPayLoad(wrapper::http::Result const &res)
+std::shared_ptr<wrapper::http::ResilientClient> createClient(std::string url, ProxyProviderConfig const &config)
 {
-    ErdGenericApiResponse response = parse(res);
-    response.checkSuccessfulOperation();
-
-    return response.getData<nlohmann::json>();
-}
+    ProxyProviderResilienceConfig const &resilience = config.resilience;
+
+    std::vector<std::string> urls{std::move(url)};
+    urls.insert(urls.end(), resilience.fallbackUrls.begin(), resilience.fallbackUrls.end());
+
+    return std::make_shared<wrapper::http::ResilientClient>(
+            urls,
+            config.maxConnections,
+            config.idleTimeout,
+            wrapper::http::Timeouts{config.connectionTimeout, config.readTimeout, config.writeTimeout},
+            wrapper::http::ResiliencePolicy{resilience.maxRetries, resilience.initialBackoff, resilience.maxBackoff, resilience.deadline,
+                                            resilience.failureThreshold, resilience.openDuration});
 }
 
-ProxyProvider::ProxyProvider(std::string url) :
-        m_url(std::move(url))
-{}
-
-Account ProxyProvider::getAccount(Address const &address)
+Account fetchAccount(wrapper::http::ResilientClient &client, Address const &address)
 {
-    wrapper::http::Client client(m_url);
     wrapper::http::Result const result = client.get("/address/" + address.getBech32Address());
 
-    auto data = internal::getPayLoad(result);
-
-    utility::requireAttribute(data, "account");
-    utility::requireAttribute(data["account"], "balance");
-    utility::requireAttribute(data["account"], "nonce");
+    return readAccount(responseBody(result), address);
+}
 
-    std::string const balance = data["account"]["balance"];
-    uint64_t const nonce = data["account"]["nonce"];
+BigUInt fetchESDTBalance(wrapper::http::ResilientClient &client, Address const &address, std::string const &token)
+{
+    wrapper::http::Result const result = client.get("/address/" + address.getBech32Address() + "/esdt/" + token);
 
-    return Account(address, BigUInt(balance), nonce);
+    return readESDTBalance(responseBody(result));
 }
 
-std::string ProxyProvider::send(Transaction const &transaction)
+NetworkConfig fetchNetworkConfig(wrapper::http::ResilientClient &client)
 {
-    wrapper::http::Client client(m_url);
-    wrapper::http::Result const result = client.post("/transaction/send", transaction.serialize(), wrapper::http::applicationJson);
-
-    auto data = internal::getPayLoad(result);
+    wrapper::http::Result const result = client.get("/network/config");
 
-    utility::requireAttribute(data, "txHash");
-    return data["txHash"];
+    return readNetworkConfig(responseBody(result));
+}
 }
 
-TransactionStatus ProxyProvider::getTransactionStatus(std::string const &txHash)
+ProxyProvider::ProxyProvider(std::string url, ProxyProviderConfig const &config) :
+        m_client(internal::createClient(std::move(url), config)),
+        m_sendBatchSize(std::max<std::size_t>(config.sendBatchSize, 1U))
 {
-    wrapper::http::Client client(m_url);
-    wrapper::http::Result const result = client.get("/transaction/" + txHash + "/status");
+    ProxyProviderCacheConfig const &cache = config.cache;
+    if (cache.networkConfigTtl.count() > 0 || cache.accountTtl.count() > 0 || cache.esdtBalanceTtl.count() > 0)
+    {
+        m_cache = std::make_shared<internal::ProxyCache>(cache);
+    }
+}
 
-    auto data = internal::getPayLoad(result);
+Account ProxyProvider::getAccount(Address const &address)
+{
+    if (!m_cache)
+    {
+        return internal::fetchAccount(*m_client, address);
+    }
 
-    utility::requireAttribute(data, "status");
+    auto const client = m_client;
+    return m_cache->accounts.get(address.getBech32Address(), [client, address]() { return internal::fetchAccount(*client, address); });
+}
 
-    std::string const txStatus = data["status"];
+std::string ProxyProvider::send(Transaction const &transaction)
+{
+    wrapper::http::Result const result = m_client->post("/transaction/send", transaction.serialize(), wrapper::http::applicationJson);
+    if (transaction.m_sender)
+    {
+        invalidateAccount(*transaction.m_sender);
+    }
 
-    return TransactionStatus(txStatus);
+    return internal::readTxHash(internal::responseBody(result));
 }
 
-BigUInt ProxyProvider::getESDTBalance(Address const &address, std::string const &token) const
+std::vector<TransactionSendResult> ProxyProvider::sendBatch(std::vector<Transaction> const &transactions)
 {
-    wrapper::http::Client client(m_url);
-    wrapper::http::Result const result = client.get("/address/" + address.getBech32Address() + "/esdt/" + token);
+    std::vector<TransactionSendResult> results(transactions.size(), TransactionSendResult{false, "", ""});
+    std::vector<std::size_t> chunk;
+    std::string body;
 
-    auto data = internal::getPayLoad(result);
+    for (std::size_t first = 0; first < transactions.size(); first += m_sendBatchSize)
+    {
+        std::size_t const last = std::min(first + m_sendBatchSize, transactions.size());
+
+        // Transactions are written straight into one json array, the ones that can not be serialized are left out
+        chunk.clear();
+        body.assign(1, '[');
+        for (std::size_t i = first; i < last; ++i)
+        {
+            std::size_t const begin = body.size();
+            try
+            {
+                if (!chunk.empty()) body.push_back(',');
+                internal::appendSerializedTransaction(transactions[i], true, body);
+                chunk.push_back(i);
+            }
+            catch (std::exception const &e)
+            {
+                body.resize(begin);
+                results[i].error = e.what();
+            }
+        }
+        body.push_back(']');
+
+        if (chunk.empty())
+        {
+            continue;
+        }
+
+        try
+        {
+            wrapper::http::Result const result = m_client->post("/transaction/send-multiple", body, wrapper::http::applicationJson);
+            for (std::size_t const i: chunk)
+            {
+                if (transactions[i].m_sender)
+                {
+                    invalidateAccount(*transactions[i].m_sender);
+                }
+            }
+
+            // Hashes are keyed by the index in the posted array, rejected transactions are missing
+            std::vector<std::string> txsHashes = internal::readTxsHashes(internal::responseBody(result), chunk.size());
+
+            for (std::size_t j = 0; j < chunk.size(); ++j)
+            {
+                TransactionSendResult &txResult = results[chunk[j]];
+                if (!txsHashes[j].empty())
+                {
+                    txResult.sent = true;
+                    txResult.txHash = std::move(txsHashes[j]);
+                }
+                else
+                {
+                    txResult.error = ERROR_MSG_TX_NOT_ACCEPTED;
+                }
+            }
+        }
+        catch (std::exception const &e)
+        {
+            for (std::size_t const i: chunk)
+            {
+                results[i] = TransactionSendResult{false, "", e.what()};
+            }
+        }
+    }
 
-    utility::requireAttribute(data, "tokenData");
-    utility::requireAttribute(data["tokenData"], "balance");
+    return results;
+}
 
-    std::string balance = data["tokenData"]["balance"];
+TransactionStatus ProxyProvider::getTransactionStatus(std::string const &txHash)
+{
+    wrapper::http::Result const result = m_client->get("/transaction/" + txHash + "/status");
 
-    return BigUInt(balance);
+    return internal::readTransactionStatus(internal::responseBody(result));
 }
 
-std::map<std::string, BigUInt> ProxyProvider::getAllESDTBalances(Address const &address) const
+BigUInt ProxyProvider::getESDTBalance(Address const &address, std::string const &token) const
 {
-    wrapper::http::Client client(m_url);
-    wrapper::http::Result const result = client.get("/address/" + address.getBech32Address() + "/esdt");
-
-    auto data = internal::getPayLoad(result);
+    if (!m_cache)
+    {
+        return internal::fetchESDTBalance(*m_client, address, token);
+    }
 
-    utility::requireAttribute(data, "esdts");
+    auto const client = m_client;
+    return m_cache->esdtBalances.get(address.getBech32Address() + "/" + token,
+                                     [client, address, token]() { return internal::fetchESDTBalance(*client, address, token); });
+}
 
-    auto esdts = data["esdts"];
+std::map<std::string, BigUInt> ProxyProvider::getAllESDTBalances(Address const &address) const
+{
+    wrapper::http::Result const result = m_client->get("/address/" + address.getBech32Address() + "/esdt");
 
-    std::map<std::string, BigUInt> ret;
-    std::string esdt;
-    std::string balance;
+    return internal::readAllESDTBalances(internal::responseBody(result));
+}
 
-    for (const auto &it: esdts.items())
+NetworkConfig ProxyProvider::getNetworkConfig() const
+{
+    if (!m_cache)
     {
-        utility::requireAttribute(it.value(), "balance");
-
-        esdt = it.key();
-        balance = it.value()["balance"];
-        ret.emplace(esdt, BigUInt(balance));
+        return internal::fetchNetworkConfig(*m_client);
     }
 
-    return ret;
+    auto const client = m_client;
+    return m_cache->networkConfig.get("", [client]() { return internal::fetchNetworkConfig(*client); });
 }
 
-NetworkConfig ProxyProvider::getNetworkConfig() const
+ProxyProviderCacheStats ProxyProvider::getCacheStats() const
 {
-    wrapper::http::Client client(m_url);
-    wrapper::http::Result const result = client.get("/network/config");
+    if (!m_cache)
+    {
+        return ProxyProviderCacheStats{0, 0, 0};
+    }
 
-    auto data = internal::getPayLoad(result);
+    return ProxyProviderCacheStats{m_cache->counters.hits, m_cache->counters.staleHits, m_cache->counters.misses};
+}
 
-    utility::requireAttribute(data, "config");
-    utility::requireAttribute(data["config"], "erd_chain_id");
-    utility::requireAttribute(data["config"], "erd_gas_per_data_byte");
-    utility::requireAttribute(data["config"], "erd_min_gas_limit");
-    utility::requireAttribute(data["config"], "erd_min_gas_price");
+void ProxyProvider::invalidateCache()
+{
+    if (m_cache)
+    {
+        m_cache->networkConfig.clear();
+        m_cache->accounts.clear();
+        m_cache->esdtBalances.clear();
+    }
+}
 
-    NetworkConfig cfg;
-    cfg.chainId = data["config"]["erd_chain_id"];
-    cfg.gasPerDataByte = data["config"]["erd_gas_per_data_byte"];
-    cfg.minGasLimit = data["config"]["erd_min_gas_limit"];
-    cfg.minGasPrice = data["config"]["erd_min_gas_price"];
+void ProxyProvider::invalidateNetworkConfig()
+{
+    if (m_cache)
+    {
+        m_cache->networkConfig.clear();
+    }
+}
 
-    return cfg;
+void ProxyProvider::invalidateAccount(Address const &address)
+{
+    if (m_cache)
+    {
+        m_cache->accounts.invalidate(address.getBech32Address());
+        m_cache->esdtBalances.invalidatePrefix(address.getBech32Address() + "/");
+    }
 }
 
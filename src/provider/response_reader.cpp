@@ -0,0 +1,278 @@
+#include "response_reader.h"
+
+namespace internal
+{
+namespace
+{
+struct AccountVisitor : ResponseVisitor
+{
+    bool hasAccount = false;
+    bool hasBalance = false;
+    bool hasNonce = false;
+    std::string balance;
+    uint64_t nonce = 0;
+
+    void beginObject(ResponsePath const &path)
+    {
+        hasAccount |= path.is("account");
+    }
+
+    void value(ResponsePath const &path, ResponseValue const &value)
+    {
+        if (path.is("account", "balance") && value.type == ResponseValue::string)
+        {
+            hasBalance = true;
+            balance = std::move(*value.stringValue);
+        }
+        else if (path.is("account", "nonce"))
+        {
+            hasNonce = value.asUnsigned(nonce);
+        }
+    }
+};
+
+struct ESDTBalanceVisitor : ResponseVisitor
+{
+    bool hasTokenData = false;
+    bool hasBalance = false;
+    std::string balance;
+
+    void beginObject(ResponsePath const &path)
+    {
+        hasTokenData |= path.is("tokenData");
+    }
+
+    void value(ResponsePath const &path, ResponseValue const &value)
+    {
+        if (path.is("tokenData", "balance") && value.type == ResponseValue::string)
+        {
+            hasBalance = true;
+            balance = std::move(*value.stringValue);
+        }
+    }
+};
+
+struct AllESDTBalancesVisitor : ResponseVisitor
+{
+    bool hasEsdts = false;
+    // Every token needs a balance
+    std::size_t numTokens = 0;
+    std::map<std::string, std::string> balances;
+
+    void beginObject(ResponsePath const &path)
+    {
+        if (path.is("esdts"))
+        {
+            hasEsdts = true;
+        }
+        else if (path.size == 2 && path.keys[0] == "esdts")
+        {
+            ++numTokens;
+        }
+    }
+
+    void value(ResponsePath const &path, ResponseValue const &value)
+    {
+        if (path.size == 3 && path.keys[2] == "balance" && path.keys[0] == "esdts" && value.type == ResponseValue::string)
+        {
+            balances[path.keys[1]] = std::move(*value.stringValue);
+        }
+        else if (path.size == 2 && path.keys[0] == "esdts")
+        {
+            ++numTokens; // Not an object, so it can not have a balance
+        }
+    }
+};
+
+struct NetworkConfigVisitor : ResponseVisitor
+{
+    bool hasConfig = false;
+    bool hasChainId = false;
+    bool hasGasPerDataByte = false;
+    bool hasMinGasLimit = false;
+    bool hasMinGasPrice = false;
+    std::string chainId;
+    uint64_t gasPerDataByte = 0;
+    uint64_t minGasLimit = 0;
+    uint64_t minGasPrice = 0;
+
+    void beginObject(ResponsePath const &path)
+    {
+        hasConfig |= path.is("config");
+    }
+
+    void value(ResponsePath const &path, ResponseValue const &value)
+    {
+        if (path.size != 2 || path.keys[0] != "config")
+        {
+            return;
+        }
+
+        std::string const &key = path.keys[1];
+        if (key == "erd_chain_id" && value.type == ResponseValue::string)
+        {
+            hasChainId = true;
+            chainId = std::move(*value.stringValue);
+        }
+        else if (key == "erd_gas_per_data_byte")
+        {
+            hasGasPerDataByte = value.asUnsigned(gasPerDataByte);
+        }
+        else if (key == "erd_min_gas_limit")
+        {
+            hasMinGasLimit = value.asUnsigned(minGasLimit);
+        }
+        else if (key == "erd_min_gas_price")
+        {
+            hasMinGasPrice = value.asUnsigned(minGasPrice);
+        }
+    }
+};
+
+// A single string directly inside "data"
+struct DataStringVisitor : ResponseVisitor
+{
+    explicit DataStringVisitor(std::string fieldName) :
+            field(std::move(fieldName))
+    {}
+
+    std::string const field;
+    bool found = false;
+    std::string result;
+
+    void value(ResponsePath const &path, ResponseValue const &value)
+    {
+        if (path.is(field) && value.type == ResponseValue::string)
+        {
+            found = true;
+            result = std::move(*value.stringValue);
+        }
+    }
+};
+
+struct TxsHashesVisitor : ResponseVisitor
+{
+    explicit TxsHashesVisitor(std::size_t const numTransactions) :
+            hashes(numTransactions)
+    {}
+
+    bool hasTxsHashes = false;
+    std::vector<std::string> hashes;
+
+    void beginObject(ResponsePath const &path)
+    {
+        hasTxsHashes |= path.is("txsHashes");
+    }
+
+    void value(ResponsePath const &path, ResponseValue const &value)
+    {
+        if (path.size != 2 || path.keys[0] != "txsHashes" || value.type != ResponseValue::string)
+        {
+            return;
+        }
+
+        std::string const &index = path.keys[1];
+        if (index.empty() || index.find_first_not_of("0123456789") != std::string::npos)
+        {
+            return;
+        }
+
+        std::size_t const i = std::stoul(index);
+        if (i < hashes.size())
+        {
+            hashes[i] = std::move(*value.stringValue);
+        }
+    }
+};
+}
+
+Account readAccount(std::string const &body, Address const &address)
+{
+    AccountVisitor visitor;
+    readResponse(body, visitor);
+
+    requireField(visitor.hasAccount, "account");
+    requireField(visitor.hasBalance, "balance");
+    requireField(visitor.hasNonce, "nonce");
+
+    return Account(address, BigUInt(visitor.balance), visitor.nonce);
+}
+
+BigUInt readESDTBalance(std::string const &body)
+{
+    ESDTBalanceVisitor visitor;
+    readResponse(body, visitor);
+
+    requireField(visitor.hasTokenData, "tokenData");
+    requireField(visitor.hasBalance, "balance");
+
+    return BigUInt(visitor.balance);
+}
+
+std::map<std::string, BigUInt> readAllESDTBalances(std::string const &body)
+{
+    AllESDTBalancesVisitor visitor;
+    readResponse(body, visitor);
+
+    requireField(visitor.hasEsdts, "esdts");
+    requireField(visitor.balances.size() == visitor.numTokens, "balance");
+
+    std::map<std::string, BigUInt> ret;
+    for (auto const &it: visitor.balances)
+    {
+        ret.emplace_hint(ret.end(), it.first, BigUInt(it.second));
+    }
+
+    return ret;
+}
+
+NetworkConfig readNetworkConfig(std::string const &body)
+{
+    NetworkConfigVisitor visitor;
+    readResponse(body, visitor);
+
+    requireField(visitor.hasConfig, "config");
+    requireField(visitor.hasChainId, "erd_chain_id");
+    requireField(visitor.hasGasPerDataByte, "erd_gas_per_data_byte");
+    requireField(visitor.hasMinGasLimit, "erd_min_gas_limit");
+    requireField(visitor.hasMinGasPrice, "erd_min_gas_price");
+
+    NetworkConfig cfg;
+    cfg.chainId = std::move(visitor.chainId);
+    cfg.gasPerDataByte = uint32_t(visitor.gasPerDataByte);
+    cfg.minGasLimit = uint32_t(visitor.minGasLimit);
+    cfg.minGasPrice = visitor.minGasPrice;
+
+    return cfg;
+}
+
+std::string readTxHash(std::string const &body)
+{
+    DataStringVisitor visitor("txHash");
+    readResponse(body, visitor);
+
+    requireField(visitor.found, "txHash");
+
+    return visitor.result;
+}
+
+TransactionStatus readTransactionStatus(std::string const &body)
+{
+    DataStringVisitor visitor("status");
+    readResponse(body, visitor);
+
+    requireField(visitor.found, "status");
+
+    return TransactionStatus(visitor.result);
+}
+
+std::vector<std::string> readTxsHashes(std::string const &body, std::size_t const numTransactions)
+{
+    TxsHashesVisitor visitor(numTransactions);
+    readResponse(body, visitor);
+
+    requireField(visitor.hasTxsHashes, "txsHashes");
+
+    return visitor.hashes;
+}
+}
@@ -0,0 +1,293 @@
+#ifndef ERD_PROXY_RESPONSE_READER_H
+#define ERD_PROXY_RESPONSE_READER_H
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "json/json.hpp"
+#include "provider/proxyprovider.h"
+#include "../utils/errors.h"
+
+// Extraction of the fields ProxyProvider needs from proxy responses, in a single streaming pass with
+// nlohmann::json::sax_parse: no json tree is built and values are moved straight into the results.
+// Errors are the same as with ErdGenericApiResponse: malformed json, a missing "code", an unsuccessful
+// code or error, and missing "data" or required fields all throw.
+namespace internal
+{
+// Keys from "data" down to a value; array elements are keyed by their index
+struct ResponsePath
+{
+    std::string const *keys;
+    std::size_t size;
+
+    bool is(std::string const &key0) const
+    {
+        return size == 1 && keys[0] == key0;
+    }
+
+    bool is(std::string const &key0, std::string const &key1) const
+    {
+        return size == 2 && keys[0] == key0 && keys[1] == key1;
+    }
+};
+
+struct ResponseValue
+{
+    enum Type
+    {
+        null,
+        boolean,
+        integer,
+        unsignedInteger,
+        floating,
+        string
+    };
+
+    Type type;
+    int64_t integerValue;
+    uint64_t unsignedValue;
+    double floatingValue;
+    bool booleanValue;
+    std::string *stringValue; // May be moved from
+
+    bool asUnsigned(uint64_t &out) const
+    {
+        if (type == unsignedInteger)
+        {
+            out = unsignedValue;
+            return true;
+        }
+        if (type == integer && integerValue >= 0)
+        {
+            out = uint64_t(integerValue);
+            return true;
+        }
+        return false;
+    }
+};
+
+// Visitors receive every scalar inside "data" through value(), and every object inside it through beginObject().
+struct ResponseVisitor
+{
+    void beginObject(ResponsePath const &)
+    {}
+};
+
+template<typename Visitor>
+class ResponseSaxHandler
+{
+public:
+    explicit ResponseSaxHandler(Visitor &visitor) :
+            m_visitor(visitor),
+            m_hasCode(false),
+            m_hasData(false)
+    {}
+
+    bool null()
+    {
+        return onValue(ResponseValue{ResponseValue::null, 0, 0, 0, false, nullptr});
+    }
+
+    bool boolean(bool const val)
+    {
+        return onValue(ResponseValue{ResponseValue::boolean, 0, 0, 0, val, nullptr});
+    }
+
+    bool number_integer(nlohmann::json::number_integer_t const val)
+    {
+        return onValue(ResponseValue{ResponseValue::integer, val, 0, 0, false, nullptr});
+    }
+
+    bool number_unsigned(nlohmann::json::number_unsigned_t const val)
+    {
+        return onValue(ResponseValue{ResponseValue::unsignedInteger, 0, val, 0, false, nullptr});
+    }
+
+    bool number_float(nlohmann::json::number_float_t const val, std::string const &)
+    {
+        return onValue(ResponseValue{ResponseValue::floating, 0, 0, val, false, nullptr});
+    }
+
+    bool string(std::string &val)
+    {
+        return onValue(ResponseValue{ResponseValue::string, 0, 0, 0, false, &val});
+    }
+
+    bool binary(nlohmann::json::binary_t &)
+    {
+        return true;
+    }
+
+    bool start_object(std::size_t)
+    {
+        nextElement();
+        if (inData())
+        {
+            m_visitor.beginObject(dataPath());
+        }
+        m_frames.push_back(Frame{false, 0});
+        m_keys.resize(m_frames.size());
+        return true;
+    }
+
+    bool key(std::string &key)
+    {
+        m_keys[m_frames.size() - 1].swap(key);
+        if (m_frames.size() == 1 && m_keys[0] == "data")
+        {
+            m_hasData = true;
+        }
+        return true;
+    }
+
+    bool end_object()
+    {
+        m_frames.pop_back();
+        return true;
+    }
+
+    bool start_array(std::size_t)
+    {
+        nextElement();
+        m_frames.push_back(Frame{true, 0});
+        m_keys.resize(m_frames.size());
+        return true;
+    }
+
+    bool end_array()
+    {
+        m_frames.pop_back();
+        return true;
+    }
+
+    bool parse_error(std::size_t, std::string const &, nlohmann::detail::exception const &)
+    {
+        return false;
+    }
+
+    // Throws if the envelope reports an error or has no data, like ErdGenericApiResponse::checkSuccessfulOperation()
+    void checkSuccessfulOperation() const
+    {
+        if (!m_hasCode)
+        {
+            throw std::invalid_argument(ERROR_MSG_JSON_KEY_NOT_FOUND + std::string("code"));
+        }
+
+        bool const success = m_error.empty() && (m_code.find("success") != std::string::npos);
+        if (!success)
+        {
+            throw std::runtime_error(ERROR_MSG_HTTP_REQUEST_FAILED + m_code + ". " + ERROR_MSG_REASON + m_error);
+        }
+
+        if (!m_hasData)
+        {
+            throw std::invalid_argument(ERROR_MSG_JSON_KEY_NOT_FOUND + std::string("data"));
+        }
+    }
+
+private:
+    struct Frame
+    {
+        bool isArray;
+        std::size_t index;
+    };
+
+    // Array elements have no key event, their index becomes their key
+    void nextElement()
+    {
+        if (!m_frames.empty() && m_frames.back().isArray)
+        {
+            m_keys[m_frames.size() - 1] = std::to_string(m_frames.back().index++);
+        }
+    }
+
+    bool inData() const
+    {
+        return !m_frames.empty() && !m_frames[0].isArray && m_keys[0] == "data";
+    }
+
+    ResponsePath dataPath() const
+    {
+        return ResponsePath{m_keys.data() + 1, m_frames.size() - 1};
+    }
+
+    bool onValue(ResponseValue const &value)
+    {
+        nextElement();
+        if (inData())
+        {
+            m_visitor.value(dataPath(), value);
+        }
+        else if (m_frames.size() == 1 && !m_frames[0].isArray)
+        {
+            if (m_keys[0] == "code")
+            {
+                m_hasCode = true;
+                if (value.type == ResponseValue::string) m_code = *value.stringValue;
+            }
+            else if (m_keys[0] == "error" && value.type == ResponseValue::string)
+            {
+                m_error = *value.stringValue;
+            }
+        }
+        return true;
+    }
+
+    Visitor &m_visitor;
+    std::vector<Frame> m_frames;
+    std::vector<std::string> m_keys;
+    bool m_hasCode;
+    bool m_hasData;
+    std::string m_code;
+    std::string m_error;
+};
+
+template<typename Visitor>
+void readResponse(std::string const &body, Visitor &visitor)
+{
+    ResponseSaxHandler<Visitor> handler(visitor);
+
+    bool parsed;
+    try
+    {
+        parsed = nlohmann::json::sax_parse(body, &handler);
+    }
+    catch (nlohmann::json::exception const &)
+    {
+        parsed = false;
+    }
+    if (!parsed)
+    {
+        throw std::invalid_argument(ERROR_MSG_JSON_SERIALIZED + body);
+    }
+
+    handler.checkSuccessfulOperation();
+}
+
+inline void requireField(bool const found, std::string const &field)
+{
+    if (!found)
+    {
+        throw std::invalid_argument(ERROR_MSG_JSON_KEY_NOT_FOUND + field);
+    }
+}
+
+Account readAccount(std::string const &body, Address const &address);
+
+BigUInt readESDTBalance(std::string const &body);
+
+std::map<std::string, BigUInt> readAllESDTBalances(std::string const &body);
+
+NetworkConfig readNetworkConfig(std::string const &body);
+
+std::string readTxHash(std::string const &body);
+
+TransactionStatus readTransactionStatus(std::string const &body);
+
+// Hashes of a /transaction/send-multiple response, by index in the posted array. Rejected transactions have an empty hash.
+std::vector<std::string> readTxsHashes(std::string const &body, std::size_t numTransactions);
+}
+
+#endif //ERD_PROXY_RESPONSE_READER_H
@@ -0,0 +1,264 @@
+#include "provider/transaction_watcher.h"
+#include "../utils/errors.h"
+
+#include <algorithm>
+
+namespace
+{
+bool isCompleted(TransactionStatus const &status)
+{
+    return status.isExecuted() || status.isFailed();
+}
+
+// Proxy answer to an invalid request, e.g. a malformed hash
+std::string const PROXY_CODE_BAD_REQUEST = "bad_request";
+
+// Malformed responses and requests rejected as invalid fail the same way on every poll, retrying them is pointless
+bool isPermanentFailure(std::exception_ptr const &error)
+{
+    try
+    {
+        std::rethrow_exception(error);
+    }
+    catch (std::invalid_argument const &)
+    {
+        return true;
+    }
+    catch (std::exception const &e)
+    {
+        return std::string(e.what()).find(ERROR_MSG_HTTP_REQUEST_FAILED + PROXY_CODE_BAD_REQUEST) == 0;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+std::string describe(std::exception_ptr const &error)
+{
+    try
+    {
+        std::rethrow_exception(error);
+    }
+    catch (std::exception const &e)
+    {
+        return e.what();
+    }
+    catch (...)
+    {
+        return "";
+    }
+}
+}
+
+// Each waiter is called on its own, an exception thrown by one of its callbacks can not keep the others uncalled.
+// A waiter whose completion callback throws gets that exception through its error callback, whose own exceptions
+// are discarded.
+void TransactionWatcher::complete(std::vector<Waiter> const &waiters, TransactionStatus const &status)
+{
+    for (auto const &waiter: waiters)
+    {
+        try
+        {
+            if (waiter.onCompleted) waiter.onCompleted(status);
+        }
+        catch (...)
+        {
+            fail(waiter, std::current_exception());
+        }
+    }
+}
+
+void TransactionWatcher::fail(std::vector<Waiter> const &waiters, std::exception_ptr const &error)
+{
+    for (auto const &waiter: waiters)
+    {
+        fail(waiter, error);
+    }
+}
+
+void TransactionWatcher::fail(Waiter const &waiter, std::exception_ptr const &error)
+{
+    try
+    {
+        if (waiter.onError) waiter.onError(error);
+    }
+    catch (...)
+    {
+    }
+}
+
+TransactionWatcher::TransactionWatcher(std::string url, ProxyProviderConfig const &proxyConfig, TransactionWatcherConfig const &config) :
+        m_config(config),
+        m_rng(std::random_device()()),
+        m_stopping(false),
+        m_proxy(new AsyncProxyProvider(std::move(url), proxyConfig, config.maxPollsInFlight))
+{
+    m_scheduler = std::thread([this]() { runScheduler(); });
+}
+
+TransactionWatcher::~TransactionWatcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_scheduleChanged.notify_all();
+    m_scheduler.join();
+
+    // Completes the polls in flight while the watches they update still exist
+    m_proxy.reset();
+
+    for (auto const &it: m_watches)
+    {
+        fail(it.second.waiters, std::make_exception_ptr(std::runtime_error(ERROR_MSG_TX_WATCHER_STOPPED + it.first)));
+    }
+}
+
+std::future<TransactionStatus> TransactionWatcher::watch(std::string const &txHash)
+{
+    auto const promise = std::make_shared<std::promise<TransactionStatus>>();
+    watch(txHash,
+          [promise](TransactionStatus const &status) { promise->set_value(status); },
+          [promise](std::exception_ptr error) { promise->set_exception(error); });
+
+    return promise->get_future();
+}
+
+void TransactionWatcher::watch(std::string const &txHash, CompletionCallback onCompleted, ErrorCallback onError)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_watches.find(txHash);
+    if (it == m_watches.end())
+    {
+        Clock::time_point const deadline = (m_config.timeout.count() > 0) ?
+                                           (Clock::now() + m_config.timeout) : Clock::time_point::max();
+        it = m_watches.emplace(txHash, Watch{{}, m_config.initialInterval, deadline, TransactionStatus(""), nullptr}).first;
+        schedule(txHash, m_config.initialInterval);
+    }
+
+    it->second.waiters.push_back(Waiter{std::move(onCompleted), std::move(onError)});
+}
+
+std::size_t TransactionWatcher::numWatched() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_watches.size();
+}
+
+// Must be called with m_mutex held
+void TransactionWatcher::schedule(std::string const &txHash, std::chrono::milliseconds const interval)
+{
+    std::uniform_real_distribution<double> jitter(1.0 - m_config.jitter, 1.0 + m_config.jitter);
+    auto const delay = std::chrono::duration_cast<Clock::duration>(interval * jitter(m_rng));
+
+    bool const earliest = m_schedule.empty() || (Clock::now() + delay < m_schedule.top().first);
+    m_schedule.emplace(Clock::now() + delay, txHash);
+    if (earliest)
+    {
+        m_scheduleChanged.notify_one();
+    }
+}
+
+void TransactionWatcher::runScheduler()
+{
+    std::vector<std::string> due;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopping)
+    {
+        if (m_schedule.empty())
+        {
+            m_scheduleChanged.wait(lock);
+            continue;
+        }
+
+        Clock::time_point const now = Clock::now();
+        if (m_schedule.top().first > now)
+        {
+            m_scheduleChanged.wait_until(lock, m_schedule.top().first);
+            continue;
+        }
+
+        due.clear();
+        while (!m_schedule.empty() && m_schedule.top().first <= now)
+        {
+            due.push_back(m_schedule.top().second);
+            m_schedule.pop();
+        }
+
+        // Submitting blocks while too many polls are in flight, which must not prevent their completion
+        lock.unlock();
+        for (std::string const &txHash: due)
+        {
+            m_proxy->getTransactionStatus(txHash,
+                                          [this, txHash](TransactionStatus status) { onPolled(txHash, &status, nullptr); },
+                                          [this, txHash](std::exception_ptr error) { onPolled(txHash, nullptr, error); });
+        }
+        lock.lock();
+    }
+}
+
+void TransactionWatcher::onPolled(std::string const &txHash, TransactionStatus const *status, std::exception_ptr error)
+{
+    std::vector<Waiter> waiters;
+    std::exception_ptr lastError;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto const it = m_watches.find(txHash);
+        if (it == m_watches.end())
+        {
+            return;
+        }
+        Watch &watch = it->second;
+
+        if (error != nullptr)
+        {
+            watch.lastError = error;
+        }
+
+        bool const retry = (status != nullptr) ? !isCompleted(*status) : !isPermanentFailure(error);
+        if (retry && Clock::now() < watch.deadline)
+        {
+            // Polling speeds up again when the status moves (e.g. from received to pending)
+            if (status != nullptr && !(watch.lastStatus == *status))
+            {
+                watch.lastStatus = *status;
+                watch.interval = m_config.initialInterval;
+            }
+            else
+            {
+                auto const next = std::chrono::duration_cast<std::chrono::milliseconds>(watch.interval * m_config.backoffMultiplier);
+                watch.interval = std::min(std::max(next, watch.interval), m_config.maxInterval);
+            }
+
+            schedule(txHash, watch.interval);
+            return;
+        }
+
+        waiters = std::move(watch.waiters);
+        lastError = watch.lastError;
+        m_watches.erase(it);
+    }
+
+    if (status != nullptr && isCompleted(*status))
+    {
+        complete(waiters, *status);
+    }
+    else if (error != nullptr && isPermanentFailure(error))
+    {
+        fail(waiters, error);
+    }
+    else
+    {
+        // The reason of the last failed poll, if any, tells why the transaction could not be followed
+        std::string message = ERROR_MSG_TX_WATCH_TIMEOUT + txHash;
+        if (lastError != nullptr)
+        {
+            message += ". " + ERROR_MSG_REASON + describe(lastError);
+        }
+        fail(waiters, std::make_exception_ptr(std::runtime_error(message)));
+    }
+}
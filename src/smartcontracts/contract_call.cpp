@@ -21,3 +21,16 @@ std::string ContractCall::asOnData() const
     return (m_function.empty()) ?
            ("") : ("@" + util::stringToHex(m_function) + m_args.asOnData());
 }
+
+void ContractCall::appendOnData(bytes &out) const
+{
+    if (m_function.empty())
+    {
+        return;
+    }
+
+    std::string const function = util::stringToHex(m_function);
+    out.push_back('@');
+    out.insert(out.end(), function.begin(), function.end());
+    m_args.appendOnData(out);
+}
@@ -21,7 +21,7 @@ void SCArguments::add(BigUInt const &arg)
 
 void SCArguments::add(Address const &arg)
 {
-    bytes const pk = arg.getPublicKey();
+    auto const &pk = arg.getPublicKey();
 
     std::string pkHex(pk.begin(), pk.end());
     pkHex = util::stringToHex(pkHex);
@@ -46,4 +46,20 @@ std::string SCArguments::asOnData() const
     return ret;
 }
 
+void SCArguments::appendOnData(bytes &out) const
+{
+    std::size_t size = out.size();
+    for (auto const &arg : m_args)
+    {
+        size += 1 + arg.size();
+    }
+    out.reserve(size);
+
+    for (auto const &arg : m_args)
+    {
+        out.push_back('@');
+        out.insert(out.end(), arg.begin(), arg.end());
+    }
+}
+
 
@@ -0,0 +1,91 @@
+#include <utility>
+
+#include "transaction/esdt.h"
+#include "transaction/esdt_transfer_template.h"
+
+ESDTTransferTemplate::ESDTTransferTemplate(std::string const &tokenIdentifier,
+                                           Address const &sender,
+                                           uint64_t const gasPrice,
+                                           std::string chainID,
+                                           GasEstimator gasEstimator) :
+        m_payloadPrefix(),
+        m_payloadSuffix(),
+        m_sender(sender),
+        m_gasPrice(gasPrice),
+        m_chainID(std::move(chainID)),
+        m_gasEstimator(std::move(gasEstimator)),
+        m_version(DEFAULT_VERSION),
+        m_options(DEFAULT_OPTIONS)
+{
+    // Same encoding as ESDTTransferPayloadBuilder, whose amount argument follows
+    std::string const function = ESDT_TRANSFER_PREFIX;
+    m_payloadPrefix.assign(function.begin(), function.end());
+
+    SCArguments args;
+    args.add(tokenIdentifier);
+    args.appendOnData(m_payloadPrefix);
+    m_payloadPrefix.push_back('@');
+}
+
+ESDTTransferTemplate &ESDTTransferTemplate::withContractCall(ContractCall const &contractCall)
+{
+    m_payloadSuffix.clear();
+    contractCall.appendOnData(m_payloadSuffix);
+    return *this;
+}
+
+ESDTTransferTemplate &ESDTTransferTemplate::withVersion(uint64_t const version)
+{
+    m_version = version;
+    return *this;
+}
+
+ESDTTransferTemplate &ESDTTransferTemplate::withOptions(uint32_t const options)
+{
+    m_options = options;
+    return *this;
+}
+
+Transaction ESDTTransferTemplate::build(uint64_t const nonce, Address const &receiver, BigUInt const &amount) const
+{
+    Transaction tx;
+    build(nonce, receiver, amount, tx);
+    return tx;
+}
+
+void ESDTTransferTemplate::build(uint64_t const nonce, Address const &receiver, BigUInt const &amount, Transaction &out) const
+{
+    std::string const amountHex = amount.getHexValue();
+
+    bytes &payload = (out.m_data == nullptr) ? out.m_data.emplace() : *out.m_data;
+    payload.clear();
+    payload.reserve(m_payloadPrefix.size() + amountHex.size() + m_payloadSuffix.size());
+    payload.insert(payload.end(), m_payloadPrefix.begin(), m_payloadPrefix.end());
+    payload.insert(payload.end(), amountHex.begin(), amountHex.end());
+    payload.insert(payload.end(), m_payloadSuffix.begin(), m_payloadSuffix.end());
+
+    out.m_receiver = receiver;
+    out.m_sender = m_sender;
+    out.m_options = m_options;
+
+    out.m_nonce = nonce;
+    out.m_value = DEFAULT_VALUE;
+    out.m_receiverUserName = DEFAULT_RECEIVER_NAME;
+    out.m_senderUserName = DEFAULT_SENDER_NAME;
+    out.m_gasPrice = m_gasPrice;
+    out.m_gasLimit = m_gasEstimator.forESDTTransfer(payload.size());
+    out.m_chainID = m_chainID;
+    out.m_version = m_version;
+    out.m_signature = DEFAULT_SIGNATURE;
+}
+
+void ESDTTransferTemplate::build(std::vector<ESDTTransferTarget> const &targets, std::vector<Transaction> &out) const
+{
+    out.resize(targets.size());
+
+    for (std::size_t i = 0; i < targets.size(); ++i)
+    {
+        ESDTTransferTarget const &target = targets[i];
+        build(target.nonce, target.receiver, target.amount, out[i]);
+    }
+}
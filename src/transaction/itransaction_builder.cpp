@@ -13,10 +13,18 @@ ITransactionBuilder &ITransactionBuilder::withVersion(uint64_t version)
 
 ITransactionBuilder &ITransactionBuilder::withOptions(uint32_t options)
 {
-    m_options = std::make_shared<uint32_t>(options);
+    m_options = options;
     return *this;
 }
 
+Transaction ITransactionBuilder::build()
+{
+    Transaction tx;
+    build(tx);
+
+    return tx;
+}
+
 
 Transaction ITransactionBuilder::buildSigned(const bytes &seed)
 {
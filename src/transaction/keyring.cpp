@@ -0,0 +1,138 @@
+#include <stdexcept>
+
+#include "transaction/keyring.h"
+#include "filehandler/isecretkey.h"
+#include "filehandler/pembundle.h"
+#include "errors.h"
+#include "parallel.h"
+#include "transaction_serializer.h"
+
+#define KEY_RING_MIN_SLOTS 16U
+
+KeyRing::KeyRing() :
+        m_signers(),
+        m_slots(KEY_RING_MIN_SLOTS, 0)
+{}
+
+bool KeyRing::add(bytes const &seed)
+{
+    Signer signer(seed);
+
+    std::size_t const slot = slotOf(signer.getAddress());
+    if (m_slots[slot] != 0)
+    {
+        return false;
+    }
+
+    m_signers.push_back(std::move(signer));
+    m_slots[slot] = uint32_t(m_signers.size());
+
+    if (2 * m_signers.size() > m_slots.size())
+    {
+        grow();
+    }
+    return true;
+}
+
+bool KeyRing::add(ISecretKey const &secretKey)
+{
+    return add(secretKey.getSeed());
+}
+
+std::size_t KeyRing::add(PemBundle const &bundle)
+{
+    reserve(size() + bundle.size());
+
+    std::size_t added = 0;
+    for (std::size_t i = 0; i < bundle.size(); ++i)
+    {
+        added += add(bundle.getSeed(i)) ? 1 : 0;
+    }
+    return added;
+}
+
+void KeyRing::reserve(std::size_t const numKeys)
+{
+    m_signers.reserve(numKeys);
+    while (2 * numKeys > m_slots.size())
+    {
+        grow();
+    }
+}
+
+std::size_t KeyRing::size() const
+{
+    return m_signers.size();
+}
+
+bool KeyRing::contains(Address const &address) const
+{
+    return find(address) != nullptr;
+}
+
+Signer const *KeyRing::find(Address const &address) const
+{
+    uint32_t const index = m_slots[slotOf(address)];
+
+    return (index == 0) ? nullptr : &m_signers[index - 1];
+}
+
+void KeyRing::sign(Transaction &transaction) const
+{
+    if (transaction.m_sender == nullptr)
+    {
+        throw std::invalid_argument(ERROR_MSG_SENDER);
+    }
+
+    Signer const *const signer = find(*transaction.m_sender);
+    if (signer == nullptr)
+    {
+        throw std::invalid_argument(ERROR_MSG_KEY_RING_UNKNOWN_SENDER + transaction.m_sender->getBech32Address());
+    }
+
+    std::string buffer;
+    internal::signTransaction(transaction, *signer, buffer);
+}
+
+std::vector<bool> KeyRing::signBatch(std::vector<Transaction> &transactions, unsigned int const numThreads) const
+{
+    // The buffer is reused by all transactions signed on the same thread
+    return util::parallelTest(transactions.size(), numThreads, [this, &transactions, buffer = std::string()](std::size_t const i) mutable
+    {
+        Transaction &tx = transactions[i];
+        Signer const *const signer = (tx.m_sender == nullptr) ? nullptr : find(*tx.m_sender);
+        if (signer == nullptr)
+        {
+            return false;
+        }
+
+        internal::signTransaction(tx, *signer, buffer);
+        return true;
+    });
+}
+
+std::size_t KeyRing::slotOf(Address const &address) const
+{
+    std::size_t const mask = m_slots.size() - 1;
+    Address::PublicKey const &publicKey = address.getPublicKey();
+
+    // Linear probing, the table is never more than half full so an empty slot is always found
+    for (std::size_t slot = std::hash<Address>()(address) & mask;; slot = (slot + 1) & mask)
+    {
+        uint32_t const index = m_slots[slot];
+        if (index == 0 || m_signers[index - 1].getAddress().getPublicKey() == publicKey)
+        {
+            return slot;
+        }
+    }
+}
+
+void KeyRing::grow()
+{
+    m_slots.assign(2 * m_slots.size(), 0);
+
+    for (std::size_t i = 0; i < m_signers.size(); ++i)
+    {
+        m_slots[slotOf(m_signers[i].getAddress())] = uint32_t(i + 1);
+    }
+}
@@ -24,6 +24,13 @@ bool MessageSigner::verify(std::string const &signature, std::string const &mess
     return Signer::verify(signature, hashedMsg, publicKey);
 }
 
+bool MessageSigner::verify(std::string const &signature, std::string const &message, Address::PublicKey const &publicKey)
+{
+    std::string const hashedMsg = computeERDPrefixedMsgHash(message);
+
+    return Signer::verify(signature, hashedMsg, publicKey);
+}
+
 bool MessageSigner::verify(std::string const &signature, std::string const &message, Address const &address)
 {
     std::string const hashedMsg = computeERDPrefixedMsgHash(message);
@@ -14,6 +14,24 @@ std::string ESDTPropertyField(std::string const &property, bool const &val)
     return "@" + util::stringToHex(property) + "@" + util::stringToHex(value);
 }
 
+void append(bytes &out, std::string const &str)
+{
+    out.insert(out.end(), str.begin(), str.end());
+}
+
+// Appends the hex encoding of str, same as SCArguments::add(std::string) but without intermediate strings
+void appendHex(bytes &out, std::string const &str)
+{
+    std::size_t const begin = out.size();
+    out.resize(begin + 2 * str.size());
+    util::bytesToHex(reinterpret_cast<uint8_t const *>(str.data()), str.size(), reinterpret_cast<char *>(out.data() + begin));
+}
+
+std::string toString(bytes const &payload)
+{
+    return std::string(payload.begin(), payload.end());
+}
+
 std::string ESDTPropertiesAsOnData(ESDTProperties const &esdtProperties)
 {
     return ESDTPropertyField("canFreeze", esdtProperties.canFreeze) +
@@ -30,7 +48,7 @@ std::string ESDTPropertiesAsOnData(ESDTProperties const &esdtProperties)
 }
 
 ESDTTransferPayloadBuilder::ESDTTransferPayloadBuilder() :
-        m_payment(TokenPayment::fungibleFromAmount("", "0", 0)),
+        m_payment(TokenPayment::fungibleFromBigUInt("", BigUInt(0))),
         m_contractCall("")
 {}
 
@@ -48,11 +66,20 @@ ESDTTransferPayloadBuilder &ESDTTransferPayloadBuilder::withContractCall(Contrac
 
 std::string ESDTTransferPayloadBuilder::build() const
 {
-    SCArguments args;
-    args.add(m_payment.tokenIdentifier());
-    args.add(m_payment.value());
+    bytes payload;
+    build(payload);
+    return toString(payload);
+}
 
-    return ESDT_TRANSFER_PREFIX + args.asOnData() + m_contractCall.asOnData();
+void ESDTTransferPayloadBuilder::build(bytes &out) const
+{
+    // Arguments are encoded straight into out, like SCArguments would
+    append(out, ESDT_TRANSFER_PREFIX);
+    out.push_back('@');
+    appendHex(out, m_payment.tokenIdentifier());
+    out.push_back('@');
+    append(out, m_payment.value().getHexValue());
+    m_contractCall.appendOnData(out);
 }
 
 ESDTNFTTransferPayloadBuilder::ESDTNFTTransferPayloadBuilder() :
@@ -79,6 +106,13 @@ ESDTNFTTransferPayloadBuilder &ESDTNFTTransferPayloadBuilder::withContractCall(C
 }
 
 std::string ESDTNFTTransferPayloadBuilder::build() const
+{
+    bytes payload;
+    build(payload);
+    return toString(payload);
+}
+
+void ESDTNFTTransferPayloadBuilder::build(bytes &out) const
 {
     SCArguments args;
     args.add(m_payment.tokenIdentifier());
@@ -86,7 +120,9 @@ std::string ESDTNFTTransferPayloadBuilder::build() const
     args.add(m_payment.value());
     args.add(Address(m_destination));
 
-    return ESDT_NFT_TRANSFER_PREFIX + args.asOnData() + m_contractCall.asOnData();
+    append(out, ESDT_NFT_TRANSFER_PREFIX);
+    args.appendOnData(out);
+    m_contractCall.appendOnData(out);
 }
 
 
@@ -114,6 +150,13 @@ MultiESDTNFTTransferPayloadBuilder &MultiESDTNFTTransferPayloadBuilder::withCont
 }
 
 std::string MultiESDTNFTTransferPayloadBuilder::build() const
+{
+    bytes payload;
+    build(payload);
+    return toString(payload);
+}
+
+void MultiESDTNFTTransferPayloadBuilder::build(bytes &out) const
 {
     SCArguments args;
     args.add(Address(m_destination));
@@ -126,7 +169,9 @@ std::string MultiESDTNFTTransferPayloadBuilder::build() const
         args.add(payment.value());
     }
 
-    return MULTI_ESDT_NFT_TRANSFER_PREFIX + args.asOnData() + m_contractCall.asOnData();
+    append(out, MULTI_ESDT_NFT_TRANSFER_PREFIX);
+    args.appendOnData(out);
+    m_contractCall.appendOnData(out);
 }
 
 ESDTIssuePayloadBuilder::ESDTIssuePayloadBuilder(std::string token) :
@@ -160,6 +205,13 @@ ESDTIssuePayloadBuilder &ESDTIssuePayloadBuilder::withProperties(ESDTProperties
 }
 
 std::string ESDTIssuePayloadBuilder::build() const
+{
+    bytes payload;
+    build(payload);
+    return toString(payload);
+}
+
+void ESDTIssuePayloadBuilder::build(bytes &out) const
 {
     SCArguments args;
     args.add(m_token);
@@ -167,8 +219,10 @@ std::string ESDTIssuePayloadBuilder::build() const
     args.add(m_initialSupply);
     args.add(BigUInt(m_numOfDecimals));
 
-    std::string data = ESDT_ISSUANCE_PREFIX + args.asOnData();
-    data += (m_esdtProperties != ESDT_ISSUANCE_DEFAULT_PROPERTIES) ? ESDTPropertiesAsOnData(m_esdtProperties) : "";
-
-    return data;
+    append(out, ESDT_ISSUANCE_PREFIX);
+    args.appendOnData(out);
+    if (m_esdtProperties != ESDT_ISSUANCE_DEFAULT_PROPERTIES)
+    {
+        append(out, ESDTPropertiesAsOnData(m_esdtProperties));
+    }
 }
@@ -1,37 +1,79 @@
+#include <sodium.h>
 #include <stdexcept>
 
 #include "transaction/signer.h"
 #include "cryptosignwrapper.h"
 #include "errors.h"
+#include "parallel.h"
 
-Signer::Signer(bytes const &seed)
+namespace
+{
+// Fills the secret key array and returns the public key, used to initialize the address
+Address::PublicKey generateKeyPair(bytes const &seed, std::array<uint8_t, SECRET_KEY_LENGTH> &secretKey)
 {
     if (seed.size() != SEED_LENGTH)
-       throw std::length_error(ERROR_MSG_KEY_BYTES_SIZE);
+        throw std::length_error(ERROR_MSG_KEY_BYTES_SIZE);
+
+    Address::PublicKey publicKey;
+    wrapper::crypto::getKeyPair(seed.data(), publicKey.data(), secretKey.data());
 
-    m_sk = wrapper::crypto::getSecretKey(seed);
+    return publicKey;
+}
+}
+
+Signer::Signer(bytes const &seed) :
+        m_sk(),
+        m_address(generateKeyPair(seed, m_sk))
+{}
+
+Signer::~Signer()
+{
+    sodium_memzero(m_sk.data(), m_sk.size());
 }
 
 std::string Signer::getSignature(std::string const &message) const
 {
-    return wrapper::crypto::getSignature(m_sk, message);
+    return wrapper::crypto::getSignature(m_sk.data(), message);
+}
+
+void Signer::sign(std::string const &message, uint8_t *signature) const
+{
+    wrapper::crypto::getSignature(m_sk.data(), message, signature);
 }
 
 bool Signer::verify(std::string const &signature, std::string const &message) const
 {
-    bytes const publicKey = wrapper::crypto::getPublicKey(m_sk);
+    return wrapper::crypto::verify(signature, message, m_address.getPublicKey());
+}
 
+bool Signer::verify(std::string const &signature, std::string const &message, bytes const &publicKey)
+{
     return wrapper::crypto::verify(signature, message, publicKey);
 }
 
-bool Signer::verify(std::string const &signature, std::string const &message, bytes const &publicKey)
+bool Signer::verify(std::string const &signature, std::string const &message, Address::PublicKey const &publicKey)
 {
     return wrapper::crypto::verify(signature, message, publicKey);
 }
 
 bool Signer::verify(const std::string &signature, const std::string &message, const Address &address)
 {
-    bytes const publicKey = address.getPublicKey();
+    return wrapper::crypto::verify(signature, message, address.getPublicKey());
+}
 
-    return wrapper::crypto::verify(signature, message, publicKey);
+std::vector<bool> Signer::verifyBatch(std::vector<SignedMessage> const &signedMessages, unsigned int const numThreads)
+{
+    return util::parallelTest(signedMessages.size(), numThreads, [&signedMessages](std::size_t const i)
+    {
+        SignedMessage const &signedMessage = signedMessages[i];
+
+        return (signedMessage.signature.size() == SIGNATURE_LENGTH) &&
+               (signedMessage.publicKey.size() == PUBLIC_KEY_LENGTH) &&
+               wrapper::crypto::verify(signedMessage.signature, signedMessage.message, signedMessage.publicKey);
+    });
+}
+
+Address const &Signer::getAddress() const
+{
+    return m_address;
 }
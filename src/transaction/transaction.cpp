@@ -3,8 +3,10 @@
 #include "hex.h"
 #include "errors.h"
 #include "params.h"
+#include "parallel.h"
 #include "jsonwrapper.h"
 #include "cryptosignwrapper.h"
+#include "transaction_serializer.h"
 
 #define OPTIONS_SIGN_TX_HASH_MASK 1U
 #define VERSION_SIGN_TX_HASH 2U
@@ -12,19 +14,11 @@
 namespace internal
 {
 template<typename T>
-void setJsonValueIfNotNull(wrapper::json::OrderedJson &json, std::string const &key, std::shared_ptr<T> const &val)
-{
-    if (val != nullptr)
-        json.set(key, *val);
-}
-
-template<typename T>
-void getJsonValueIfNotNull(wrapper::json::OrderedJson const &json, std::string const &key, std::shared_ptr<T> &val)
+void getJsonValueIfNotNull(wrapper::json::OrderedJson const &json, std::string const &key, Optional<T> &val)
 {
     if (json.contains(key))
     {
-        T const tmpVal = json.at<T>(key);
-        val = std::make_shared<T>(tmpVal);
+        val = json.at<T>(key);
     }
 }
 
@@ -35,36 +29,27 @@ bool shouldSignHash(Transaction const &tx)
            (*tx.m_options & OPTIONS_SIGN_TX_HASH_MASK);
 }
 
-std::string getSerializedTxMsg(Transaction tx, bool const withSignature)
+void getSerializedTxMsg(Transaction const &tx, bool const withSignature, std::string &buffer)
 {
-    if (!withSignature)
-    {
-        tx.m_signature = nullptr;
-    }
-
-    std::string txSerialized = tx.serialize();
+    buffer.clear();
+    appendSerializedTransaction(tx, withSignature, buffer);
 
     if (shouldSignHash(tx))
     {
-        txSerialized = wrapper::crypto::sha3Keccak(txSerialized);
+        buffer = wrapper::crypto::sha3Keccak(buffer);
     }
-
-    return txSerialized;
 }
 
-template<typename T>
-inline bool pointersHaveSameValue(std::shared_ptr<T> v1, std::shared_ptr<T> v2)
+void signTransaction(Transaction &tx, Signer const &signer, std::string &buffer)
 {
-    if (v1 == nullptr && v2 == nullptr)
-    {
-        return true;
-    }
-    if (v1 != nullptr && v2 != nullptr)
-    {
-        return *v1.get() == *v2.get();
-    }
-
-    return false;
+    getSerializedTxMsg(tx, false, buffer);
+    uint8_t signature[SIGNATURE_LENGTH];
+    signer.sign(buffer, signature);
+
+    // Hex digits are written over the previous signature, if any, reusing its buffer
+    std::string &hexSignature = tx.m_signature ? *tx.m_signature : tx.m_signature.emplace();
+    hexSignature.resize(2 * SIGNATURE_LENGTH);
+    util::bytesToHex(signature, SIGNATURE_LENGTH, &hexSignature[0]);
 }
 
 }
@@ -74,19 +59,19 @@ Transaction::Transaction(
         BigUInt value,
         Address const &receiver,
         Address const &sender,
-        std::shared_ptr<bytes> receiverUserName,
-        std::shared_ptr<bytes> senderUserName,
+        Optional<bytes> receiverUserName,
+        Optional<bytes> senderUserName,
         uint64_t const &gasPrice,
         uint64_t const &gasLimit,
-        std::shared_ptr<bytes> data,
-        std::shared_ptr<std::string> signature,
+        Optional<bytes> data,
+        Optional<std::string> signature,
         std::string chainID,
         uint64_t const &version,
-        std::shared_ptr<uint32_t> options) :
+        Optional<uint32_t> options) :
         m_nonce(nonce),
         m_value(std::move(value)),
-        m_receiver(new Address(receiver)),
-        m_sender(new Address(sender)),
+        m_receiver(receiver),
+        m_sender(sender),
         m_receiverUserName(std::move(receiverUserName)),
         m_senderUserName(std::move(senderUserName)),
         m_gasPrice(gasPrice),
@@ -119,17 +104,17 @@ bool Transaction::operator==(const Transaction &rhs) const
 {
     return (this->m_nonce == rhs.m_nonce &&
             this->m_value == rhs.m_value &&
-            internal::pointersHaveSameValue(this->m_sender, rhs.m_sender) &&
-            internal::pointersHaveSameValue(this->m_receiver, rhs.m_receiver) &&
-            internal::pointersHaveSameValue(this->m_senderUserName, rhs.m_senderUserName) &&
-            internal::pointersHaveSameValue(this->m_receiverUserName, rhs.m_receiverUserName) &&
+            this->m_sender == rhs.m_sender &&
+            this->m_receiver == rhs.m_receiver &&
+            this->m_senderUserName == rhs.m_senderUserName &&
+            this->m_receiverUserName == rhs.m_receiverUserName &&
             this->m_gasPrice == rhs.m_gasPrice &&
             this->m_gasLimit == rhs.m_gasLimit &&
-            internal::pointersHaveSameValue(this->m_data, rhs.m_data) &&
-            internal::pointersHaveSameValue(this->m_signature, rhs.m_signature) &&
+            this->m_data == rhs.m_data &&
+            this->m_signature == rhs.m_signature &&
             this->m_chainID == rhs.m_chainID &&
             this->m_version == rhs.m_version &&
-            internal::pointersHaveSameValue(this->m_options, rhs.m_options)
+            this->m_options == rhs.m_options
     );
 }
 
@@ -140,11 +125,21 @@ bool Transaction::operator!=(const Transaction &rhs) const
 
 void Transaction::sign(Signer const &signer)
 {
-    std::string const txSerialized = internal::getSerializedTxMsg(*this, false);
-    std::string const tmpSign = signer.getSignature(txSerialized);
-    std::string const signature = util::stringToHex(tmpSign);
+    std::string buffer;
+    internal::signTransaction(*this, signer, buffer);
+}
 
-    m_signature.reset(new std::string(signature));
+void Transaction::signBatch(std::vector<Transaction> &transactions, Signer const &signer, unsigned int const numThreads)
+{
+    util::parallelFor(transactions.size(), numThreads, [&transactions, &signer](std::size_t const begin, std::size_t const end)
+    {
+        std::string buffer; // Reused by all transactions signed on this thread
+
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            internal::signTransaction(transactions[i], signer, buffer);
+        }
+    });
 }
 
 bool Transaction::verify()
@@ -152,33 +147,47 @@ bool Transaction::verify()
     if (m_signature == nullptr) throw std::runtime_error(ERROR_MSG_SIGNATURE);
     if (m_sender == nullptr) throw std::runtime_error(ERROR_MSG_SENDER);
 
-    std::string const txSerialized = internal::getSerializedTxMsg(*this, false);
+    std::string txSerialized;
+    internal::getSerializedTxMsg(*this, false, txSerialized);
 
     return Signer::verify(util::hexToString(*m_signature), txSerialized, *m_sender);
 }
 
+std::vector<bool> Transaction::verifyBatch(std::vector<Transaction> const &transactions, unsigned int const numThreads)
+{
+    // The buffer is reused by all transactions verified on the same thread
+    return util::parallelTest(transactions.size(), numThreads, [&transactions, buffer = std::string()](std::size_t const i) mutable
+    {
+        Transaction const &tx = transactions[i];
+        if (tx.m_signature == nullptr || tx.m_sender == nullptr || tx.m_signature->size() != 2 * SIGNATURE_LENGTH)
+        {
+            return false;
+        }
+
+        try
+        {
+            internal::getSerializedTxMsg(tx, false, buffer);
+            return Signer::verify(util::hexToString(*tx.m_signature), buffer, *tx.m_sender);
+        }
+        catch (std::invalid_argument const &)
+        {
+            return false;
+        }
+    });
+}
+
 std::string Transaction::serialize() const
 {
-    if (m_receiver == nullptr) throw std::invalid_argument(ERROR_MSG_RECEIVER);
-    if (m_sender == nullptr) throw std::invalid_argument(ERROR_MSG_SENDER);
+    std::string txSerialized;
+    serialize(txSerialized);
 
-    wrapper::json::OrderedJson json;
+    return txSerialized;
+}
 
-    json.set(TX_NONCE, m_nonce);
-    json.set(TX_VALUE, m_value.getValue());
-    json.set(TX_RECEIVER, (*m_receiver).getBech32Address());
-    json.set(TX_SENDER, (*m_sender).getBech32Address());
-    internal::setJsonValueIfNotNull(json, TX_RECEIVER_NAME, m_receiverUserName);
-    internal::setJsonValueIfNotNull(json, TX_SENDER_NAME, m_senderUserName);
-    json.set(TX_GAS_PRICE, m_gasPrice);
-    json.set(TX_GAS_LIMIT, m_gasLimit);
-    internal::setJsonValueIfNotNull(json, TX_DATA, m_data);
-    internal::setJsonValueIfNotNull(json, TX_SIGNATURE, m_signature);
-    json.set(TX_CHAIN_ID, m_chainID);
-    json.set(TX_VERSION, m_version);
-    internal::setJsonValueIfNotNull(json, TX_OPTIONS, m_options);
-
-    return json.serialize();
+void Transaction::serialize(std::string &buffer) const
+{
+    buffer.clear();
+    internal::appendSerializedTransaction(*this, true, buffer);
 }
 
 void Transaction::deserialize(std::string const &serializedTransaction)
@@ -205,8 +214,8 @@ void Transaction::deserialize(std::string const &serializedTransaction)
 
     m_nonce = json.at<uint64_t>(TX_NONCE);
     m_value = BigUInt(json.at<std::string>(TX_VALUE));
-    m_receiver.reset(new Address(json.at<std::string>(TX_RECEIVER)));
-    m_sender.reset(new Address(json.at<std::string>(TX_SENDER)));
+    m_receiver.emplace(json.at<std::string>(TX_RECEIVER));
+    m_sender.emplace(json.at<std::string>(TX_SENDER));
     m_gasPrice = json.at<uint64_t>(TX_GAS_PRICE);
     m_gasLimit = json.at<uint64_t>(TX_GAS_LIMIT);
     m_chainID = json.at<std::string>(TX_CHAIN_ID);
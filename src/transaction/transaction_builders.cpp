@@ -5,9 +5,42 @@
 
 namespace
 {
-std::shared_ptr<bytes> stringToBytesPtr(std::string const &in)
+// Overwrites every field but the data, which the caller fills in. Optional fields keep their storage when set again.
+void setFields(Transaction &out,
+               uint64_t const nonce,
+               BigUInt const &value,
+               Address const &receiver,
+               Address const &sender,
+               uint64_t const gasPrice,
+               uint64_t const gasLimit,
+               std::string const &chainID,
+               uint64_t const version,
+               Optional<uint32_t> const &options)
 {
-    return in.empty() ? DEFAULT_DATA : std::make_shared<bytes>(in.begin(), in.end());
+    out.m_nonce = nonce;
+    out.m_value = value;
+    out.m_receiver = receiver;
+    out.m_sender = sender;
+    out.m_receiverUserName = DEFAULT_RECEIVER_NAME;
+    out.m_senderUserName = DEFAULT_SENDER_NAME;
+    out.m_gasPrice = gasPrice;
+    out.m_gasLimit = gasLimit;
+    out.m_signature = DEFAULT_SIGNATURE;
+    out.m_chainID = chainID;
+    out.m_version = version;
+    out.m_options = options;
+}
+
+// Empty data buffer of the transaction, keeping the capacity of its previous data
+bytes &clearedData(Transaction &out)
+{
+    if (out.m_data == nullptr)
+    {
+        return out.m_data.emplace();
+    }
+
+    out.m_data->clear();
+    return *out.m_data;
 }
 }
 
@@ -17,26 +50,38 @@ TransactionEGLDTransferBuilder::TransactionEGLDTransferBuilder(TransactionBuilde
         m_txInput(std::move(txInput))
 {}
 
-Transaction TransactionEGLDTransferBuilder::build()
+void TransactionEGLDTransferBuilder::build(Transaction &out)
 {
-    uint64_t inputGasLimit = m_txInput.gasLimit;
-    uint64_t estimatedGasLimit = m_txInput.gasEstimator.forEGLDTransfer(m_txInput.data.size());
-    uint64_t gasLimit = (inputGasLimit == DEFAULT_GAS_LIMIT) ? estimatedGasLimit : inputGasLimit;
-
-    return Transaction(
-            m_txInput.nonce,
-            m_txInput.value,
-            m_txInput.receiver,
-            m_txInput.sender,
-            DEFAULT_SENDER_NAME,
-            DEFAULT_RECEIVER_NAME,
-            m_txInput.gasPrice,
-            gasLimit,
-            stringToBytesPtr(m_txInput.data),
-            DEFAULT_SIGNATURE,
-            m_txInput.chainID,
-            m_version,
-            m_options);
+    assemble(out, m_txInput.nonce, m_txInput.value, m_txInput.sender, m_txInput.receiver, m_txInput.data, m_txInput.gasPrice,
+             m_txInput.gasLimit, m_txInput.chainID, m_txInput.gasEstimator, m_version, m_options);
+}
+
+void TransactionEGLDTransferBuilder::assemble(Transaction &out,
+                                              uint64_t const nonce,
+                                              BigUInt const &value,
+                                              Address const &sender,
+                                              Address const &receiver,
+                                              std::string const &data,
+                                              uint64_t const gasPrice,
+                                              uint64_t const gasLimit,
+                                              std::string const &chainID,
+                                              GasEstimator const &gasEstimator,
+                                              uint64_t const version,
+                                              Optional<uint32_t> const &options)
+{
+    uint64_t const estimatedGasLimit = gasEstimator.forEGLDTransfer(data.size());
+
+    setFields(out, nonce, value, receiver, sender, gasPrice, (gasLimit == DEFAULT_GAS_LIMIT) ? estimatedGasLimit : gasLimit,
+              chainID, version, options);
+
+    if (data.empty())
+    {
+        out.m_data = DEFAULT_DATA;
+    }
+    else
+    {
+        clearedData(out).assign(data.begin(), data.end());
+    }
 }
 
 // -------------------- ESDT Transfer --------------------
@@ -46,28 +91,33 @@ TransactionESDTBuilder::TransactionESDTBuilder(TransactionBuilderInput txInput,
         m_tokenPayment(std::move(payment))
 {}
 
-Transaction TransactionESDTBuilder::build()
+void TransactionESDTBuilder::build(Transaction &out)
 {
-    std::string payload = ESDTTransferPayloadBuilder()
-            .setPayment(m_tokenPayment)
-            .withContractCall(m_contractCall)
-            .build();
-    uint64_t gasLimit = m_txInput.gasEstimator.forESDTTransfer(payload.size());
-
-    return Transaction(
-            m_txInput.nonce,
-            DEFAULT_VALUE,
-            m_txInput.receiver,
-            m_txInput.sender,
-            DEFAULT_SENDER_NAME,
-            DEFAULT_RECEIVER_NAME,
-            m_txInput.gasPrice,
-            gasLimit,
-            stringToBytesPtr(payload),
-            DEFAULT_SIGNATURE,
-            m_txInput.chainID,
-            m_version,
-            m_options);
+    assemble(out, m_tokenPayment, m_contractCall, m_txInput.nonce, m_txInput.sender, m_txInput.receiver, m_txInput.gasPrice,
+             m_txInput.chainID, m_txInput.gasEstimator, m_version, m_options);
+}
+
+void TransactionESDTBuilder::assemble(Transaction &out,
+                                      TokenPayment const &payment,
+                                      ContractCall const &contractCall,
+                                      uint64_t const nonce,
+                                      Address const &sender,
+                                      Address const &receiver,
+                                      uint64_t const gasPrice,
+                                      std::string const &chainID,
+                                      GasEstimator const &gasEstimator,
+                                      uint64_t const version,
+                                      Optional<uint32_t> const &options)
+{
+    // The payload is built directly into the transaction data buffer
+    bytes &payload = clearedData(out);
+    ESDTTransferPayloadBuilder()
+            .setPayment(payment)
+            .withContractCall(contractCall)
+            .build(payload);
+    uint64_t const gasLimit = gasEstimator.forESDTTransfer(payload.size());
+
+    setFields(out, nonce, DEFAULT_VALUE, receiver, sender, gasPrice, gasLimit, chainID, version, options);
 }
 
 // -------------------- ESDT NFT Transfer --------------------
@@ -77,29 +127,34 @@ TransactionESDTNFTBuilder::TransactionESDTNFTBuilder(TransactionBuilderInput txI
         m_tokenPayment(std::move(payment))
 {}
 
-Transaction TransactionESDTNFTBuilder::build()
+void TransactionESDTNFTBuilder::build(Transaction &out)
+{
+    assemble(out, m_tokenPayment, m_contractCall, m_txInput.nonce, m_txInput.sender, m_txInput.receiver, m_txInput.gasPrice,
+             m_txInput.chainID, m_txInput.gasEstimator, m_version, m_options);
+}
+
+void TransactionESDTNFTBuilder::assemble(Transaction &out,
+                                         TokenPayment const &payment,
+                                         ContractCall const &contractCall,
+                                         uint64_t const nonce,
+                                         Address const &sender,
+                                         Address const &destination,
+                                         uint64_t const gasPrice,
+                                         std::string const &chainID,
+                                         GasEstimator const &gasEstimator,
+                                         uint64_t const version,
+                                         Optional<uint32_t> const &options)
 {
-    std::string payload = ESDTNFTTransferPayloadBuilder()
-            .setPayment(m_tokenPayment)
-            .setDestination(m_txInput.receiver)
-            .withContractCall(m_contractCall)
-            .build();
-    uint64_t gasLimit = m_txInput.gasEstimator.forESDTNFTTransfer(payload.size());
-
-    return Transaction(
-            m_txInput.nonce,
-            DEFAULT_VALUE,
-            m_txInput.sender,
-            m_txInput.sender, // sender = receiver
-            DEFAULT_SENDER_NAME,
-            DEFAULT_RECEIVER_NAME,
-            m_txInput.gasPrice,
-            gasLimit,
-            stringToBytesPtr(payload),
-            DEFAULT_SIGNATURE,
-            m_txInput.chainID,
-            m_version,
-            m_options);
+    bytes &payload = clearedData(out);
+    ESDTNFTTransferPayloadBuilder()
+            .setPayment(payment)
+            .setDestination(destination)
+            .withContractCall(contractCall)
+            .build(payload);
+    uint64_t const gasLimit = gasEstimator.forESDTNFTTransfer(payload.size());
+
+    // sender = receiver
+    setFields(out, nonce, DEFAULT_VALUE, sender, sender, gasPrice, gasLimit, chainID, version, options);
 }
 
 // -------------------- Multi ESDT NFT Transfer --------------------
@@ -109,28 +164,32 @@ TransactionMultiESDTNFTBuilder::TransactionMultiESDTNFTBuilder(TransactionBuilde
         m_tokenPayments(std::move(payments))
 {}
 
-Transaction TransactionMultiESDTNFTBuilder::build()
+void TransactionMultiESDTNFTBuilder::build(Transaction &out)
 {
-    std::string payload = MultiESDTNFTTransferPayloadBuilder()
-            .setPayments(m_tokenPayments)
-            .setDestination(m_txInput.receiver)
-            .withContractCall(m_contractCall)
-            .build();
-    uint64_t gasLimit = m_txInput.gasEstimator.forMultiESDTNFTTransfer(payload.size(), m_tokenPayments.size());
-
-    return Transaction(
-            m_txInput.nonce,
-            DEFAULT_VALUE,
-            m_txInput.sender,
-            m_txInput.sender, // sender = receiver
-            DEFAULT_SENDER_NAME,
-            DEFAULT_RECEIVER_NAME,
-            m_txInput.gasPrice,
-            gasLimit,
-            stringToBytesPtr(payload),
-            DEFAULT_SIGNATURE,
-            m_txInput.chainID,
-            m_version,
-            m_options
-    );
+    assemble(out, m_tokenPayments, m_contractCall, m_txInput.nonce, m_txInput.sender, m_txInput.receiver, m_txInput.gasPrice,
+             m_txInput.chainID, m_txInput.gasEstimator, m_version, m_options);
+}
+
+void TransactionMultiESDTNFTBuilder::assemble(Transaction &out,
+                                              std::vector<TokenPayment> const &payments,
+                                              ContractCall const &contractCall,
+                                              uint64_t const nonce,
+                                              Address const &sender,
+                                              Address const &destination,
+                                              uint64_t const gasPrice,
+                                              std::string const &chainID,
+                                              GasEstimator const &gasEstimator,
+                                              uint64_t const version,
+                                              Optional<uint32_t> const &options)
+{
+    bytes &payload = clearedData(out);
+    MultiESDTNFTTransferPayloadBuilder()
+            .setPayments(payments)
+            .setDestination(destination)
+            .withContractCall(contractCall)
+            .build(payload);
+    uint64_t const gasLimit = gasEstimator.forMultiESDTNFTTransfer(payload.size(), payments.size());
+
+    // sender = receiver
+    setFields(out, nonce, DEFAULT_VALUE, sender, sender, gasPrice, gasLimit, chainID, version, options);
 }
@@ -76,6 +76,13 @@ TransactionFactory::createESDTTransfer(TokenPayment tokenPayment,
     return std::make_unique<TransactionESDTBuilder>(builder);
 }
 
+ESDTTransferTemplate TransactionFactory::createESDTTransferTemplate(std::string const &tokenIdentifier,
+                                                                   Address const &sender,
+                                                                   uint64_t gasPrice) const
+{
+    return ESDTTransferTemplate(tokenIdentifier, sender, gasPrice, m_chainID, m_gasEstimator);
+}
+
 std::unique_ptr<ITokenTransactionBuilder>
 TransactionFactory::createESDTNFTTransfer(TokenPayment tokenPayment,
                                           uint64_t nonce,
@@ -115,3 +122,48 @@ TransactionFactory::createMultiESDTNFTTransfer(std::vector<TokenPayment> tokenPa
 
     return std::make_unique<TransactionMultiESDTNFTBuilder>(builder);
 }
+
+void TransactionFactory::buildEGLDTransfer(Transaction &out,
+                                           uint64_t nonce,
+                                           BigUInt const &value,
+                                           Address const &sender,
+                                           Address const &receiver,
+                                           uint64_t gasPrice,
+                                           std::string const &data) const
+{
+    TransactionEGLDTransferBuilder::assemble(out, nonce, value, sender, receiver, data, gasPrice, DEFAULT_GAS_LIMIT, m_chainID,
+                                             m_gasEstimator, DEFAULT_VERSION, DEFAULT_OPTIONS);
+}
+
+void TransactionFactory::buildESDTTransfer(Transaction &out,
+                                           TokenPayment const &tokenPayment,
+                                           uint64_t nonce,
+                                           Address const &sender,
+                                           Address const &receiver,
+                                           uint64_t gasPrice) const
+{
+    TransactionESDTBuilder::assemble(out, tokenPayment, ContractCall(""), nonce, sender, receiver, gasPrice, m_chainID,
+                                     m_gasEstimator, DEFAULT_VERSION, DEFAULT_OPTIONS);
+}
+
+void TransactionFactory::buildESDTNFTTransfer(Transaction &out,
+                                              TokenPayment const &tokenPayment,
+                                              uint64_t nonce,
+                                              Address const &sender,
+                                              Address const &destination,
+                                              uint64_t gasPrice) const
+{
+    TransactionESDTNFTBuilder::assemble(out, tokenPayment, ContractCall(""), nonce, sender, destination, gasPrice, m_chainID,
+                                        m_gasEstimator, DEFAULT_VERSION, DEFAULT_OPTIONS);
+}
+
+void TransactionFactory::buildMultiESDTNFTTransfer(Transaction &out,
+                                                   std::vector<TokenPayment> const &tokenPayments,
+                                                   uint64_t nonce,
+                                                   Address const &sender,
+                                                   Address const &destination,
+                                                   uint64_t gasPrice) const
+{
+    TransactionMultiESDTNFTBuilder::assemble(out, tokenPayments, ContractCall(""), nonce, sender, destination, gasPrice, m_chainID,
+                                             m_gasEstimator, DEFAULT_VERSION, DEFAULT_OPTIONS);
+}
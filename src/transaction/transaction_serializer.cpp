@@ -0,0 +1,218 @@
+#include "transaction_serializer.h"
+
+#include "errors.h"
+#include "params.h"
+#include "base64.h"
+
+#include <stdexcept>
+
+// Rough upper bound of the json overhead (keys, quotes, numbers, bech32 addresses) of a serialized transaction
+#define SERIALIZED_TX_BASE_CAPACITY 384U
+
+namespace
+{
+bool isContinuationByte(unsigned char c, unsigned char min = 0x80, unsigned char max = 0xBF)
+{
+    return (c >= min) && (c <= max);
+}
+
+// Returns the length of the valid UTF-8 sequence starting at pos, or 0 if the sequence is invalid.
+// Accepts exactly the same sequences as the UTF-8 decoder used by nlohmann::json (see Unicode table 3-7).
+std::size_t utf8SequenceLength(std::string const &str, std::size_t pos)
+{
+    auto const size = str.size();
+    auto const at = [&str](std::size_t i) { return static_cast<unsigned char>(str[i]); };
+    unsigned char const lead = at(pos);
+
+    if (lead >= 0xC2 && lead <= 0xDF)
+    {
+        return (pos + 1 < size && isContinuationByte(at(pos + 1))) ? 2 : 0;
+    }
+    if (lead >= 0xE0 && lead <= 0xEF)
+    {
+        unsigned char const min = (lead == 0xE0) ? 0xA0 : 0x80;
+        unsigned char const max = (lead == 0xED) ? 0x9F : 0xBF;
+        return (pos + 2 < size &&
+                isContinuationByte(at(pos + 1), min, max) &&
+                isContinuationByte(at(pos + 2))) ? 3 : 0;
+    }
+    if (lead >= 0xF0 && lead <= 0xF4)
+    {
+        unsigned char const min = (lead == 0xF0) ? 0x90 : 0x80;
+        unsigned char const max = (lead == 0xF4) ? 0x8F : 0xBF;
+        return (pos + 3 < size &&
+                isContinuationByte(at(pos + 1), min, max) &&
+                isContinuationByte(at(pos + 2)) &&
+                isContinuationByte(at(pos + 3))) ? 4 : 0;
+    }
+
+    return 0;
+}
+
+class CanonicalJsonWriter
+{
+public:
+    explicit CanonicalJsonWriter(std::string &out) :
+            m_out(out),
+            m_empty(true)
+    {
+        m_out.push_back('{');
+    }
+
+    void writeUInt(char const *key, uint64_t value)
+    {
+        writeKey(key);
+        appendUInt(value);
+    }
+
+    // Used for values which can never contain characters that need escaping (e.g. bech32 addresses, decimal values)
+    void writePlainString(char const *key, std::string const &value)
+    {
+        writeKey(key);
+        m_out.push_back('"');
+        m_out.append(value);
+        m_out.push_back('"');
+    }
+
+    void writeString(char const *key, std::string const &value)
+    {
+        writeKey(key);
+        m_out.push_back('"');
+        appendEscaped(key, value);
+        m_out.push_back('"');
+    }
+
+    void writeBase64(char const *key, bytes const &value)
+    {
+        writeKey(key);
+        m_out.push_back('"');
+        util::base64::encode(value.data(), value.size(), m_out);
+        m_out.push_back('"');
+    }
+
+    void close()
+    {
+        m_out.push_back('}');
+    }
+
+private:
+    void writeKey(char const *key)
+    {
+        if (!m_empty)
+        {
+            m_out.push_back(',');
+        }
+        m_empty = false;
+
+        m_out.push_back('"');
+        m_out.append(key);
+        m_out.append("\":");
+    }
+
+    void appendUInt(uint64_t value)
+    {
+        char digits[20];
+        char *const end = digits + sizeof(digits);
+        char *begin = end;
+
+        do
+        {
+            *--begin = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+
+        m_out.append(begin, end);
+    }
+
+    void appendEscaped(char const *key, std::string const &value)
+    {
+        static char const hexDigits[] = "0123456789abcdef";
+
+        std::size_t pos = 0;
+        while (pos < value.size())
+        {
+            unsigned char const c = static_cast<unsigned char>(value[pos]);
+
+            if (c >= 0x80)
+            {
+                std::size_t const len = utf8SequenceLength(value, pos);
+                if (len == 0)
+                {
+                    throw std::invalid_argument(ERROR_MSG_JSON_INVALID_UTF8 + key);
+                }
+                m_out.append(value, pos, len);
+                pos += len;
+                continue;
+            }
+
+            switch (c)
+            {
+                case '\b': m_out.append("\\b"); break;
+                case '\t': m_out.append("\\t"); break;
+                case '\n': m_out.append("\\n"); break;
+                case '\f': m_out.append("\\f"); break;
+                case '\r': m_out.append("\\r"); break;
+                case '"':  m_out.append("\\\""); break;
+                case '\\': m_out.append("\\\\"); break;
+                default:
+                {
+                    if (c <= 0x1F)
+                    {
+                        m_out.append("\\u00");
+                        m_out.push_back(hexDigits[c >> 4]);
+                        m_out.push_back(hexDigits[c & 15]);
+                    }
+                    else
+                    {
+                        m_out.push_back(static_cast<char>(c));
+                    }
+                }
+            }
+            ++pos;
+        }
+    }
+
+    std::string &m_out;
+    bool m_empty;
+};
+
+template<typename T>
+std::size_t sizeIfNotNull(Optional<T> const &val)
+{
+    return (val != nullptr) ? val->size() : 0U;
+}
+
+}
+
+namespace internal
+{
+void appendSerializedTransaction(Transaction const &transaction, bool const withSignature, std::string &out)
+{
+    if (transaction.m_receiver == nullptr) throw std::invalid_argument(ERROR_MSG_RECEIVER);
+    if (transaction.m_sender == nullptr) throw std::invalid_argument(ERROR_MSG_SENDER);
+
+    out.reserve(out.size() +
+                SERIALIZED_TX_BASE_CAPACITY +
+                (sizeIfNotNull(transaction.m_data) * 4) / 3 +
+                sizeIfNotNull(transaction.m_signature) +
+                transaction.m_chainID.size());
+
+    CanonicalJsonWriter json(out);
+
+    json.writeUInt(TX_NONCE, transaction.m_nonce);
+    json.writePlainString(TX_VALUE, transaction.m_value.getValue());
+    json.writePlainString(TX_RECEIVER, transaction.m_receiver->getBech32Address());
+    json.writePlainString(TX_SENDER, transaction.m_sender->getBech32Address());
+    if (transaction.m_receiverUserName != nullptr) json.writeBase64(TX_RECEIVER_NAME, *transaction.m_receiverUserName);
+    if (transaction.m_senderUserName != nullptr) json.writeBase64(TX_SENDER_NAME, *transaction.m_senderUserName);
+    json.writeUInt(TX_GAS_PRICE, transaction.m_gasPrice);
+    json.writeUInt(TX_GAS_LIMIT, transaction.m_gasLimit);
+    if (transaction.m_data != nullptr) json.writeBase64(TX_DATA, *transaction.m_data);
+    if (withSignature && transaction.m_signature != nullptr) json.writeString(TX_SIGNATURE, *transaction.m_signature);
+    json.writeString(TX_CHAIN_ID, transaction.m_chainID);
+    json.writeUInt(TX_VERSION, transaction.m_version);
+    if (transaction.m_options != nullptr) json.writeUInt(TX_OPTIONS, *transaction.m_options);
+
+    json.close();
+}
+}
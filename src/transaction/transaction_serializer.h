@@ -0,0 +1,18 @@
+#ifndef ERD_TRANSACTION_SERIALIZER_H
+#define ERD_TRANSACTION_SERIALIZER_H
+
+#include <string>
+
+#include "transaction/transaction.h"
+
+namespace internal
+{
+// Appends the canonical json form of the transaction to the output buffer. Fields are written in the
+// same order and with the same formatting as nlohmann::ordered_json::dump(), but without building a json tree.
+void appendSerializedTransaction(Transaction const &transaction, bool withSignature, std::string &out);
+
+// Sets the signature of the transaction. The buffer holds its serialized message afterwards and can be reused between calls.
+void signTransaction(Transaction &tx, Signer const &signer, std::string &buffer);
+}
+
+#endif //ERD_TRANSACTION_SERIALIZER_H
@@ -0,0 +1,40 @@
+#ifndef ERD_BACKOFF_H
+#define ERD_BACKOFF_H
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+namespace util
+{
+// Exponential backoff with jitter: the delay before retry n (starting at 0) is uniformly distributed in [cap / 2, cap],
+// where cap = min(maxDelay, initialDelay * 2^n). The randomization spreads out retries of requests that failed together.
+class Backoff
+{
+public:
+    Backoff(std::chrono::milliseconds const initialDelay, std::chrono::milliseconds const maxDelay) :
+            m_initialDelay(std::max(initialDelay, std::chrono::milliseconds(0))),
+            m_maxDelay(std::max(maxDelay, m_initialDelay))
+    {}
+
+    template<typename Rng>
+    std::chrono::milliseconds delay(unsigned int const retry, Rng &rng) const
+    {
+        auto cap = m_initialDelay;
+        for (unsigned int i = 0; i < retry && cap < m_maxDelay; ++i)
+        {
+            cap *= 2;
+        }
+        cap = std::min(cap, m_maxDelay);
+
+        std::uniform_int_distribution<std::chrono::milliseconds::rep> jitter(cap.count() / 2, cap.count());
+        return std::chrono::milliseconds(jitter(rng));
+    }
+
+private:
+    std::chrono::milliseconds const m_initialDelay;
+    std::chrono::milliseconds const m_maxDelay;
+};
+}
+
+#endif
@@ -1,46 +1,152 @@
 #include "base64.h"
-#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+char const ENCODE_TABLE[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Base64 value of each character, -1 for characters outside the alphabet
+int8_t const DECODE_TABLE[256] = {
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1, -1, 63,
+        52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -1, -1, -1,
+        -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
+        -1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+        41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+inline int8_t decodeChar(char c)
+{
+    return DECODE_TABLE[static_cast<unsigned char>(c)];
+}
+
+// Length of the prefix made only of base64 alphabet characters
+std::size_t validPrefixLength(char const *in, std::size_t size)
+{
+    std::size_t length = 0;
+    while (length < size && decodeChar(in[length]) != -1)
+    {
+        ++length;
+    }
+    return length;
+}
+
+// A trailing group of 2 or 3 characters holds 1 or 2 bytes, a single character holds none
+std::size_t bytesForChars(std::size_t numChars)
+{
+    std::size_t const tail = numChars % 4;
+    return (numChars / 4) * 3 + ((tail > 1) ? (tail - 1) : 0);
+}
+}
+
+std::size_t util::base64::encodedLength(std::size_t const size)
+{
+    return 4 * ((size + 2) / 3);
+}
 
 std::string util::base64::encode(const std::string &in)
 {
     std::string out;
+    encode(reinterpret_cast<unsigned char const *>(in.data()), in.size(), out);
+    return out;
+}
+
+void util::base64::encode(unsigned char const *data, std::size_t const size, std::string &out)
+{
+    std::size_t const begin = out.size();
+    out.resize(begin + encodedLength(size));
+    encode(data, size, &out[begin]);
+}
+
+void util::base64::encode(unsigned char const *data, std::size_t const size, char *out)
+{
+    std::size_t i = 0;
+    for (; i + 3 <= size; i += 3)
+    {
+        uint32_t const triple = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8) | data[i + 2];
+        *out++ = ENCODE_TABLE[(triple >> 18) & 0x3F];
+        *out++ = ENCODE_TABLE[(triple >> 12) & 0x3F];
+        *out++ = ENCODE_TABLE[(triple >> 6) & 0x3F];
+        *out++ = ENCODE_TABLE[triple & 0x3F];
+    }
 
-    int val = 0, valb = -6;
-    for (uchar c : in)
+    std::size_t const remaining = size - i;
+    if (remaining == 1)
     {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0)
-        {
-            out.push_back("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"[(val >> valb) & 0x3F]);
-            valb -= 6;
-        }
+        uint32_t const triple = uint32_t(data[i]) << 16;
+        *out++ = ENCODE_TABLE[(triple >> 18) & 0x3F];
+        *out++ = ENCODE_TABLE[(triple >> 12) & 0x3F];
+        *out++ = '=';
+        *out++ = '=';
+    }
+    else if (remaining == 2)
+    {
+        uint32_t const triple = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8);
+        *out++ = ENCODE_TABLE[(triple >> 18) & 0x3F];
+        *out++ = ENCODE_TABLE[(triple >> 12) & 0x3F];
+        *out++ = ENCODE_TABLE[(triple >> 6) & 0x3F];
+        *out++ = '=';
     }
-    if (valb > -6)
-        out.push_back(
-                "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (out.size() % 4) out.push_back('=');
-    return out;
 }
 
 std::string util::base64::decode(const std::string &in)
 {
-    std::string out;
+    std::string out(decodedLength(in.data(), in.size()), '\0');
+    if (!out.empty())
+    {
+        decode(in.data(), in.size(), reinterpret_cast<unsigned char *>(&out[0]));
+    }
+    return out;
+}
 
-    std::vector<int> T(256, -1);
-    for (int i = 0; i < 64; i++) T["ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"[i]] = i;
+std::size_t util::base64::decodedLength(char const *in, std::size_t const size)
+{
+    return bytesForChars(validPrefixLength(in, size));
+}
+
+std::size_t util::base64::decode(char const *in, std::size_t const size, unsigned char *out)
+{
+    std::size_t const numChars = validPrefixLength(in, size);
+    unsigned char *const begin = out;
+
+    std::size_t i = 0;
+    for (; i + 4 <= numChars; i += 4)
+    {
+        uint32_t const quad = (uint32_t(decodeChar(in[i])) << 18) |
+                              (uint32_t(decodeChar(in[i + 1])) << 12) |
+                              (uint32_t(decodeChar(in[i + 2])) << 6) |
+                              uint32_t(decodeChar(in[i + 3]));
+        *out++ = uchar(quad >> 16);
+        *out++ = uchar(quad >> 8);
+        *out++ = uchar(quad);
+    }
 
-    int val = 0, valb = -8;
-    for (uchar c : in)
+    std::size_t const remaining = numChars - i;
+    if (remaining >= 2)
     {
-        if (T[c] == -1) break;
-        val = (val << 6) + T[c];
-        valb += 6;
-        if (valb >= 0)
+        uint32_t quad = (uint32_t(decodeChar(in[i])) << 18) | (uint32_t(decodeChar(in[i + 1])) << 12);
+        if (remaining == 3)
+        {
+            quad |= uint32_t(decodeChar(in[i + 2])) << 6;
+        }
+
+        *out++ = uchar(quad >> 16);
+        if (remaining == 3)
         {
-            out.push_back(char((val >> valb) & 0xFF));
-            valb -= 8;
+            *out++ = uchar(quad >> 8);
         }
     }
-    return out;
+
+    return std::size_t(out - begin);
 }
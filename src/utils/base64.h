@@ -1,6 +1,7 @@
 #ifndef ERD_BASE64_H
 #define ERD_BASE64_H
 
+#include <cstddef>
 #include <string>
 
 typedef unsigned char uchar;
@@ -11,7 +12,22 @@ namespace base64
 {
 std::string encode(const std::string &in);
 
+// Appends the encoding of size bytes starting at data to out
+void encode(unsigned char const *data, std::size_t size, std::string &out);
+
+// Writes exactly encodedLength(size) characters to out
+void encode(unsigned char const *data, std::size_t size, char *out);
+
+std::size_t encodedLength(std::size_t size);
+
+// Decoding stops at the first character outside the base64 alphabet, including padding
 std::string decode(const std::string &in);
+
+// Number of bytes decode() writes for the given input
+std::size_t decodedLength(char const *in, std::size_t size);
+
+// Writes decodedLength(in, size) bytes to out and returns that length
+std::size_t decode(char const *in, std::size_t size, unsigned char *out);
 }
 }
 
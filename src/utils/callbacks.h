@@ -0,0 +1,41 @@
+#ifndef ERD_CALLBACKS_H
+#define ERD_CALLBACKS_H
+
+#include <exception>
+#include <memory>
+
+namespace util
+{
+// Passes the result of request() to onResult, or the exception it threw to onError. The callbacks run outside of
+// the request's try block, so an exception thrown by onResult is never reported as a failed request. Exceptions
+// thrown by either callback are discarded: the thread running the request (e.g. a pool worker) has no one to
+// report them to, and they must not prevent it from running further requests.
+template<typename T, typename Request, typename OnResult, typename OnError>
+void deliverResult(Request const &request, OnResult const &onResult, OnError const &onError)
+{
+    std::unique_ptr<T> result;
+    try
+    {
+        result.reset(new T(request()));
+    }
+    catch (...)
+    {
+        try
+        {
+            onError(std::current_exception());
+        }
+        catch (...)
+        {}
+        return;
+    }
+
+    try
+    {
+        onResult(std::move(*result));
+    }
+    catch (...)
+    {}
+}
+}
+
+#endif
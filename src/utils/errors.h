@@ -16,6 +16,7 @@ errorMessage const ERROR_MSG_GAS_LIMIT = "Invalid gas limit.";
 errorMessage const ERROR_MSG_CHAIN_ID = "Invalid chain id.";
 errorMessage const ERROR_MSG_VERSION = "Invalid version.";
 errorMessage const ERROR_MSG_SIGNATURE = "Missing signature.";
+errorMessage const ERROR_MSG_KEY_RING_UNKNOWN_SENDER = "Key ring has no key of sender: ";
 errorMessage const ERROR_MSG_SODIUM_INIT = "Could not initialize sodium library.";
 
 errorMessage const ERROR_MSG_BECH32 = "Invalid bech32 address.";
@@ -24,13 +25,22 @@ errorMessage const ERROR_MSG_CONVERT_BITS = "Cannot convert bits";
 errorMessage const ERROR_MSG_FILE_EMPTY = "File is empty.";
 errorMessage const ERROR_MSG_FILE_DOES_NOT_EXIST = "File does not exists: ";
 errorMessage const ERROR_MSG_FILE_EXTENSION_INVALID = "File extension invalid.";
+errorMessage const ERROR_MSG_FILE_MAP = "Could not map file to memory: ";
+errorMessage const ERROR_MSG_PEM_BLOCK = "Invalid PEM block: ";
 errorMessage const ERROR_MSG_KEY_BYTES_SIZE = "Key bytes size invalid.";
 errorMessage const ERROR_MSG_JSON_SERIALIZED = "Invalid serialized json string: ";
 errorMessage const ERROR_MSG_JSON_SERIALIZE_EMPTY = "Empty json.";
 errorMessage const ERROR_MSG_JSON_KEY_NOT_FOUND = "Json does not contain key: ";
 errorMessage const ERROR_MSG_JSON_SET = "Json can not insert key:  ";
+errorMessage const ERROR_MSG_JSON_INVALID_UTF8 = "Json value is not a valid UTF-8 string, key: ";
 errorMessage const ERROR_MSG_HTTP_REQUEST_FAILED = "Request failed with message: ";
 errorMessage const ERROR_MSG_REASON = "Error reason: ";
+errorMessage const ERROR_MSG_HTTP_NO_RESPONSE = "No response from the proxy, reason: ";
+errorMessage const ERROR_MSG_HTTP_DEADLINE_EXCEEDED = "Request deadline exceeded.";
+errorMessage const ERROR_MSG_HTTP_NO_ENDPOINT_AVAILABLE = "No proxy available, the circuit breakers of all of them are open.";
+errorMessage const ERROR_MSG_TX_NOT_ACCEPTED = "Transaction not accepted by the proxy.";
+errorMessage const ERROR_MSG_TX_WATCH_TIMEOUT = "Transaction did not complete in time: ";
+errorMessage const ERROR_MSG_TX_WATCHER_STOPPED = "Transaction watcher stopped before the transaction completed: ";
 errorMessage const ERROR_MSG_KEY_FILE = "Invalid keyfile.";
 errorMessage const ERROR_MSG_MAC = "MAC mismatch, possibly wrong password.";
 errorMessage const ERROR_MSG_SCRYPTSY = "Scrypt function failed. Could not derive keys, possible cause: operating system refused to allocate the amount of requested memory.";
@@ -41,5 +51,7 @@ errorMessage const ERROR_MSG_MISSING_PASSWORD = "Missing key file password.";
 
 errorMessage const ERROR_MSG_NEGATIVE_VALUE = "Received negative value";
 errorMessage const ERROR_MSG_CANNOT_CONVERT_TO_BASE = "Cannot convert number to base: ";
+errorMessage const ERROR_MSG_NOT_A_DIGIT = "Not a digit in base 10: ";
+errorMessage const ERROR_MSG_DIVISION_BY_ZERO = "Division by zero";
 
 #endif
@@ -2,6 +2,10 @@
 #include "errors.h"
 #include <stdexcept>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace
 {
 int hexValue(unsigned char hexDigit)
@@ -28,50 +32,144 @@ int hexValue(unsigned char hexDigit)
     if (value == -1) throw std::invalid_argument(ERROR_MSG_HEX);
     return value;
 }
+
+char const HEX_DIGITS[] = "0123456789abcdef";
+
+inline uint8_t hexByte(char const *hex)
+{
+    return uint8_t(hexValue((unsigned char) hex[0]) << 4 | hexValue((unsigned char) hex[1]));
+}
+
+#ifdef __SSE2__
+// Encodes 16 bytes into 32 hex digits
+inline void bytesToHex16(uint8_t const *data, char *out)
+{
+    __m128i const lowNibbleMask = _mm_set1_epi8(0x0F);
+    __m128i const nine = _mm_set1_epi8(9);
+    __m128i const letterOffset = _mm_set1_epi8('a' - '0' - 10);
+    __m128i const zero = _mm_set1_epi8('0');
+
+    __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(data));
+    __m128i const high = _mm_and_si128(_mm_srli_epi16(input, 4), lowNibbleMask);
+    __m128i const low = _mm_and_si128(input, lowNibbleMask);
+
+    __m128i const highDigits = _mm_add_epi8(_mm_add_epi8(high, zero),
+                                            _mm_and_si128(_mm_cmpgt_epi8(high, nine), letterOffset));
+    __m128i const lowDigits = _mm_add_epi8(_mm_add_epi8(low, zero),
+                                           _mm_and_si128(_mm_cmpgt_epi8(low, nine), letterOffset));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_unpacklo_epi8(highDigits, lowDigits));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16), _mm_unpackhi_epi8(highDigits, lowDigits));
+}
+
+// Value of each of 16 hex digits, with valid set to 0xFF for every valid digit
+inline __m128i hexValues16(__m128i const digits, __m128i &valid)
+{
+    __m128i const minusOne = _mm_set1_epi8(-1);
+
+    // Only '0'..'9' map into [0, 9] and only 'a'..'f' / 'A'..'F' map into [0, 5], wrapping included
+    __m128i const decimal = _mm_sub_epi8(digits, _mm_set1_epi8('0'));
+    __m128i const isDecimal = _mm_and_si128(_mm_cmpgt_epi8(decimal, minusOne),
+                                            _mm_cmplt_epi8(decimal, _mm_set1_epi8(10)));
+    __m128i const letter = _mm_sub_epi8(_mm_or_si128(digits, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i const isLetter = _mm_and_si128(_mm_cmpgt_epi8(letter, minusOne),
+                                           _mm_cmplt_epi8(letter, _mm_set1_epi8(6)));
+
+    valid = _mm_or_si128(isDecimal, isLetter);
+    return _mm_or_si128(_mm_and_si128(decimal, isDecimal),
+                        _mm_and_si128(_mm_add_epi8(letter, _mm_set1_epi8(10)), isLetter));
+}
+
+// Decodes 32 hex digits into 16 bytes, returns false if any digit is invalid
+inline bool hexToBytes16(char const *hex, uint8_t *out)
+{
+    __m128i validFirst, validSecond;
+    __m128i const first = hexValues16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(hex)), validFirst);
+    __m128i const second = hexValues16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(hex + 16)), validSecond);
+
+    if (_mm_movemask_epi8(_mm_and_si128(validFirst, validSecond)) != 0xFFFF)
+    {
+        return false;
+    }
+
+    // Each 16 bit lane holds (high digit, low digit), combine them into high << 4 | low
+    __m128i const lowByteMask = _mm_set1_epi16(0x00FF);
+    __m128i const packedFirst = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(first, lowByteMask), 4),
+                                             _mm_srli_epi16(first, 8));
+    __m128i const packedSecond = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(second, lowByteMask), 4),
+                                              _mm_srli_epi16(second, 8));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(packedFirst, packedSecond));
+    return true;
+}
+#endif
 }
 
 namespace util
 {
 bytes hexToBytes(const std::string &hex)
 {
-    bytes ret;
+    bytes ret((hex.size() + 1) / 2);
+    hexToBytes(hex.data(), hex.size(), ret.data());
+    return ret;
+}
 
-    for (unsigned int i = 0; i < hex.length(); i += 2)
+std::size_t hexToBytes(char const *hex, std::size_t const size, uint8_t *out)
+{
+    std::size_t i = 0;
+#ifdef __SSE2__
+    for (; i + 32 <= size; i += 32, out += 16)
+    {
+        if (!hexToBytes16(hex + i, out)) throw std::invalid_argument(ERROR_MSG_HEX);
+    }
+#endif
+    for (; i + 2 <= size; i += 2)
+    {
+        *out++ = hexByte(hex + i);
+    }
+    if (i < size)
     {
-        std::string byteString = hex.substr(i, 2);
-        char byte = (char) strtol(byteString.c_str(), nullptr, 16);
-        ret.push_back(byte);
+        *out = uint8_t(hexValue((unsigned char) hex[i]));
     }
 
-    return ret;
+    return (size + 1) / 2;
 }
 
 std::string stringToHex(const std::string &input)
 {
-    static const char hexDigits[] = "0123456789abcdef";
-
-    std::string output;
-    output.reserve(input.length() * 2);
-    for (unsigned char c : input)
+    std::string output(input.length() * 2, '\0');
+    if (!input.empty())
     {
-        output.push_back(hexDigits[c >> 4]);
-        output.push_back(hexDigits[c & 15]);
+        bytesToHex(reinterpret_cast<uint8_t const *>(input.data()), input.size(), &output[0]);
     }
     return output;
 }
 
+void bytesToHex(uint8_t const *data, std::size_t const size, char *out)
+{
+    std::size_t i = 0;
+#ifdef __SSE2__
+    for (; i + 16 <= size; i += 16, out += 32)
+    {
+        bytesToHex16(data + i, out);
+    }
+#endif
+    for (; i < size; ++i)
+    {
+        *out++ = HEX_DIGITS[data[i] >> 4];
+        *out++ = HEX_DIGITS[data[i] & 15];
+    }
+}
+
 std::string hexToString(const std::string &input)
 {
     const auto len = input.length();
     if (len & 1) throw std::invalid_argument("odd length");
 
-    std::string output;
-    output.reserve(len / 2);
-    for (auto it = input.begin(); it != input.end();)
+    std::string output(len / 2, '\0');
+    if (len)
     {
-        int hi = hexValue(*it++);
-        int lo = hexValue(*it++);
-        output.push_back(hi << 4 | lo);
+        hexToBytes(input.data(), len, reinterpret_cast<uint8_t *>(&output[0]));
     }
     return output;
 }
@@ -1,15 +1,23 @@
 #ifndef ERD_HEX_H
 #define ERD_HEX_H
 
+#include <cstddef>
 #include <string>
 #include "internal/internal.h"
 
 namespace util
 {
+// A trailing single digit becomes its own byte (e.g. "fab03" -> fa b0 03). Throws on invalid digits.
 bytes hexToBytes(const std::string &hex);
 
+// Writes (size + 1) / 2 bytes to out, with the same rules as above, and returns that length
+std::size_t hexToBytes(char const *hex, std::size_t size, uint8_t *out);
+
 std::string stringToHex(const std::string &input);
 
+// Writes 2 * size lowercase hex digits to out
+void bytesToHex(uint8_t const *data, std::size_t size, char *out);
+
 std::string hexToString(const std::string &input);
 }
 
@@ -0,0 +1,82 @@
+#ifndef ERD_MAPPED_FILE_H
+#define ERD_MAPPED_FILE_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "errors.h"
+
+namespace util
+{
+// Read only memory mapping of a whole file, for single pass parsing of large files without copying them
+class MappedFile
+{
+public:
+    explicit MappedFile(std::string const &filePath) :
+            m_data(nullptr),
+            m_size(0)
+    {
+        int const fd = ::open(filePath.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::invalid_argument(ERROR_MSG_FILE_DOES_NOT_EXIST + filePath);
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            throw std::invalid_argument(ERROR_MSG_FILE_DOES_NOT_EXIST + filePath);
+        }
+
+        m_size = std::size_t(info.st_size);
+        if (m_size > 0)
+        {
+            void *const data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error(ERROR_MSG_FILE_MAP + filePath);
+            }
+            ::madvise(data, m_size, MADV_SEQUENTIAL);
+            m_data = static_cast<char const *>(data);
+        }
+
+        // The mapping stays valid after the descriptor is closed
+        ::close(fd);
+    }
+
+    ~MappedFile()
+    {
+        if (m_data != nullptr)
+        {
+            ::munmap(const_cast<char *>(m_data), m_size);
+        }
+    }
+
+    MappedFile(MappedFile const &) = delete;
+
+    MappedFile &operator=(MappedFile const &) = delete;
+
+    char const *data() const
+    {
+        return m_data;
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    char const *m_data;
+    std::size_t m_size;
+};
+}
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef ERD_PARALLEL_H
+#define ERD_PARALLEL_H
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <system_error>
+#include <vector>
+
+namespace util
+{
+inline unsigned int defaultNumThreads()
+{
+    unsigned int const numThreads = std::thread::hardware_concurrency();
+    return (numThreads == 0) ? 1U : numThreads;
+}
+
+// Splits [0, count) into contiguous chunks of similar size and calls func(begin, end) for each chunk on its own thread.
+// If numThreads is 0, one thread per hardware core is used. Exceptions thrown by any chunk are rethrown in the
+// calling thread (first one wins), after all threads have finished.
+template<typename Func>
+void parallelFor(std::size_t const count, unsigned int numThreads, Func func)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    numThreads = (numThreads == 0) ? defaultNumThreads() : numThreads;
+    std::size_t const numChunks = std::min<std::size_t>(numThreads, count);
+
+    if (numChunks == 1)
+    {
+        func(std::size_t(0), count);
+        return;
+    }
+
+    std::exception_ptr error = nullptr;
+    std::mutex errorMutex;
+
+    auto const runChunk = [&](std::size_t const begin, std::size_t const end)
+    {
+        try
+        {
+            func(begin, end);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (error == nullptr)
+            {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numChunks - 1);
+
+    std::size_t const chunkSize = count / numChunks;
+    std::size_t const remainder = count % numChunks;
+    std::size_t begin = 0;
+
+    for (std::size_t chunk = 0; chunk < numChunks; ++chunk)
+    {
+        std::size_t const end = begin + chunkSize + ((chunk < remainder) ? 1 : 0);
+
+        if (chunk + 1 == numChunks)
+        {
+            runChunk(begin, end); // Last chunk runs on the calling thread
+        }
+        else
+        {
+            try
+            {
+                threads.emplace_back(runChunk, begin, end);
+            }
+            catch (std::system_error const &)
+            {
+                runChunk(begin, end); // Could not spawn another thread, run the chunk in place
+            }
+        }
+        begin = end;
+    }
+
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+
+    if (error != nullptr)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+// Returns pred(i) for each i in [0, count), computed with parallelFor. Each chunk calls its own copy of pred, so state
+// captured by value in a mutable lambda (e.g. a buffer reused across items) is never shared between threads.
+template<typename Pred>
+std::vector<bool> parallelTest(std::size_t const count, unsigned int const numThreads, Pred const &pred)
+{
+    // std::vector<bool> packs bits, so threads cannot safely write neighbouring results into it
+    std::vector<char> results(count, false);
+
+    parallelFor(count, numThreads, [&pred, &results](std::size_t const begin, std::size_t const end)
+    {
+        Pred chunkPred(pred);
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            results[i] = chunkPred(i);
+        }
+    });
+
+    return std::vector<bool>(results.begin(), results.end());
+}
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef ERD_RATE_LIMITER_H
+#define ERD_RATE_LIMITER_H
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace util
+{
+// Thread safe token bucket: on average at most ratePerSecond acquisitions per second, of which up to burst may happen at
+// once after an idle period. Callers over the limit are delayed, never rejected. A rate of 0 disables the limit.
+class RateLimiter
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    RateLimiter(double const ratePerSecond, std::size_t const burst) :
+            m_interval((ratePerSecond > 0) ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / ratePerSecond)) : Clock::duration(0)),
+            m_tolerance(m_interval * long(std::max<std::size_t>(burst, 1U) - 1)),
+            m_nextTheoretical(Clock::now())
+    {}
+
+    RateLimiter(RateLimiter const &) = delete;
+
+    RateLimiter &operator=(RateLimiter const &) = delete;
+
+    // Blocks until the caller may proceed
+    void acquire()
+    {
+        Clock::time_point const start = reserve();
+        std::this_thread::sleep_until(start);
+    }
+
+    // Reserves the next slot and returns when it starts, without waiting for it
+    Clock::time_point reserve()
+    {
+        Clock::time_point const now = Clock::now();
+        if (m_interval == Clock::duration(0))
+        {
+            return now;
+        }
+
+        // Generic cell rate algorithm: each acquisition moves the theoretical arrival time one interval further
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Clock::time_point const start = std::max(now, m_nextTheoretical - m_tolerance);
+        m_nextTheoretical = std::max(m_nextTheoretical, now) + m_interval;
+        return start;
+    }
+
+private:
+    Clock::duration const m_interval;
+    Clock::duration const m_tolerance;
+
+    std::mutex m_mutex;
+    Clock::time_point m_nextTheoretical;
+};
+}
+
+#endif
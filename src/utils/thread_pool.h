@@ -0,0 +1,141 @@
+#ifndef ERD_THREAD_POOL_H
+#define ERD_THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace util
+{
+// Fixed number of worker threads running tasks in submission order. At most maxPending tasks are queued or running:
+// submit() blocks the caller until a slot frees up, which applies backpressure to producers. Tasks submitted from
+// a worker thread of the same pool (e.g. from a completion callback) never block, so they can not deadlock the pool.
+// The destructor runs all pending tasks before joining the workers. Exceptions escaping a task are discarded.
+class ThreadPool
+{
+public:
+    ThreadPool(unsigned int numThreads, std::size_t maxPending) :
+            m_maxPending((maxPending == 0) ? 1U : maxPending),
+            m_numPending(0),
+            m_stopping(false)
+    {
+        numThreads = (numThreads == 0) ? 1U : numThreads;
+        m_threads.reserve(numThreads);
+        for (unsigned int i = 0; i < numThreads; ++i)
+        {
+            m_threads.emplace_back([this]() { run(); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_taskAvailable.notify_all();
+
+        for (auto &thread: m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    ThreadPool(ThreadPool const &) = delete;
+
+    ThreadPool &operator=(ThreadPool const &) = delete;
+
+    void submit(std::function<void()> task)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (currentPool() != this)
+            {
+                m_slotAvailable.wait(lock, [this]() { return m_numPending < m_maxPending; });
+            }
+            m_tasks.push_back(std::move(task));
+            ++m_numPending;
+        }
+        m_taskAvailable.notify_one();
+    }
+
+    // Same as submit(), but returns false instead of blocking when the pool is full
+    bool trySubmit(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_numPending >= m_maxPending && currentPool() != this)
+            {
+                return false;
+            }
+            m_tasks.push_back(std::move(task));
+            ++m_numPending;
+        }
+        m_taskAvailable.notify_one();
+        return true;
+    }
+
+    // Number of tasks queued or running
+    std::size_t numPending() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_numPending;
+    }
+
+private:
+    static ThreadPool *&currentPool()
+    {
+        static thread_local ThreadPool *pool = nullptr;
+        return pool;
+    }
+
+    void run()
+    {
+        currentPool() = this;
+
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_taskAvailable.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+                if (m_tasks.empty())
+                {
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+
+            try
+            {
+                task();
+            }
+            catch (...)
+            {}
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                --m_numPending;
+            }
+            m_slotAvailable.notify_one();
+        }
+    }
+
+    std::size_t const m_maxPending;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_taskAvailable;
+    std::condition_variable m_slotAvailable;
+    std::deque<std::function<void()>> m_tasks;
+    std::size_t m_numPending;
+    bool m_stopping;
+
+    std::vector<std::thread> m_threads;
+};
+}
+
+#endif
@@ -2,6 +2,8 @@
 #include "errors.h"
 
 #include <sodium.h>
+#include <algorithm>
+#include <new>
 #include <stdexcept>
 #include "aes_128_ctr/aes.hpp"
 #include "keccak/sha3.hpp"
@@ -26,15 +28,22 @@ namespace crypto
 {
 std::string getSignature(bytes const &secretKey, std::string const &message)
 {
-    auto msg = CONST_UCHAR_PTR(message);
-    auto sk = CONST_UCHAR_PTR(secretKey);
+    return getSignature(secretKey.data(), message);
+}
 
+std::string getSignature(uint8_t const *secretKey, std::string const &message)
+{
     unsigned char sig[SIGNATURE_LENGTH];
-    unsigned long long sigLength;
+    getSignature(secretKey, message, sig);
 
-    crypto_sign_detached(sig, &sigLength, msg, message.length(), sk);
+    return std::string(sig, sig + SIGNATURE_LENGTH);
+}
+
+void getSignature(uint8_t const *secretKey, std::string const &message, uint8_t *signature)
+{
+    auto msg = CONST_UCHAR_PTR(message);
 
-    return std::string(sig, sig + sigLength);
+    crypto_sign_detached(signature, nullptr, msg, message.length(), secretKey);
 }
 
 bytes getSeed(bytes const &secretKey)
@@ -71,18 +80,42 @@ bytes getPublicKey(bytes const &secretKey)
     return bytes(pk, pk + PUBLIC_KEY_LENGTH);
 }
 
+void getKeyPair(uint8_t const *seed, uint8_t *publicKey, uint8_t *secretKey)
+{
+    crypto_sign_seed_keypair(publicKey, secretKey, seed);
+}
+
 bool verify(std::string const &signature, std::string const &message, bytes const &publicKey)
 {
+    if (publicKey.size() != PUBLIC_KEY_LENGTH)
+    {
+        return false;
+    }
+
+    return verify(signature, message, publicKey.data());
+}
+
+bool verify(std::string const &signature, std::string const &message, uint8_t const *publicKey)
+{
+    if (signature.size() != SIGNATURE_LENGTH)
+    {
+        return false;
+    }
+
     auto sig = CONST_UCHAR_PTR(signature);
     auto msg = CONST_UCHAR_PTR(message);
-    auto pk = CONST_UCHAR_PTR(publicKey);
     auto msgLen = message.size();
 
-    int const res = crypto_sign_verify_detached(sig, msg, msgLen, pk);
+    int const res = crypto_sign_verify_detached(sig, msg, msgLen, publicKey);
 
     return res == 0;
 }
 
+bool verify(std::string const &signature, std::string const &message, std::array<uint8_t, PUBLIC_KEY_LENGTH> const &publicKey)
+{
+    return verify(signature, message, publicKey.data());
+}
+
 bytes scrypt(std::string const &password, KdfParams const &kdfParams)
 {
     unsigned int const keyLength = kdfParams.dklen;
@@ -133,7 +166,11 @@ bytes aes128ctrDecrypt(bytes const &key, std::string cipherText, std::string con
     AES_init_ctx_iv(&ctx, k, initVector);
     AES_CTR_xcrypt_buffer(&ctx, cipher, cipherSize);
 
-    return bytes(cipher, cipher + cipherSize);
+    bytes plainText(cipher, cipher + cipherSize);
+    sodium_memzero(cipher, cipherSize);
+    sodium_memzero(&ctx, sizeof(ctx));
+
+    return plainText;
 }
 
 std::string sha3Keccak(std::string const &message)
@@ -146,6 +183,59 @@ std::string sha3Keccak(std::string const &message)
     return std::string(out, out + SHA3_KECCAK_BYTES);
 }
 
+void keyedHash(uint8_t const *key, std::string const &message, uint8_t *hash)
+{
+    crypto_auth_hmacsha256_state state;
+
+    crypto_auth_hmacsha256_init(&state, key, KEYED_HASH_KEY_BYTES);
+    crypto_auth_hmacsha256_update(&state, CONST_UCHAR_PTR(message), message.size());
+    crypto_auth_hmacsha256_final(&state, hash);
+
+    sodium_memzero(&state, sizeof(state));
+}
+
+void randomBytes(uint8_t *buffer, std::size_t const size)
+{
+    randombytes_buf(buffer, size);
+}
+
+SecureBuffer::SecureBuffer(std::size_t const size) :
+        m_data(nullptr),
+        m_size(size)
+{
+    // sodium_malloc() needs the page size found by sodium_init(), which can be called any number of times
+    if (sodium_init() < 0)
+    {
+        throw std::runtime_error(ERROR_MSG_SODIUM_INIT);
+    }
+
+    m_data = static_cast<uint8_t *>(sodium_malloc(std::max<std::size_t>(size, 1U)));
+    if (m_data == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+}
+
+SecureBuffer::~SecureBuffer()
+{
+    sodium_free(m_data);
+}
+
+uint8_t *SecureBuffer::data()
+{
+    return m_data;
+}
+
+uint8_t const *SecureBuffer::data() const
+{
+    return m_data;
+}
+
+std::size_t SecureBuffer::size() const
+{
+    return m_size;
+}
+
 }
 }
 
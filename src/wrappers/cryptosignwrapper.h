@@ -1,16 +1,15 @@
 #ifndef ERD_WRAPPER_CRYPTO_SIGN_H
 #define ERD_WRAPPER_CRYPTO_SIGN_H
 
+#include <array>
 #include <string>
 
 #include "internal/internal.h"
 
-#define PUBLIC_KEY_LENGTH 32U
-#define SECRET_KEY_LENGTH 64U
-#define SEED_LENGTH 32U
-#define SIGNATURE_LENGTH 64U
 #define HMAC_SHA256_BYTES 32U
 #define SHA3_KECCAK_BYTES 32U
+#define KEYED_HASH_BYTES HMAC_SHA256_BYTES
+#define KEYED_HASH_KEY_BYTES 32U
 
 namespace wrapper
 {
@@ -18,14 +17,25 @@ namespace crypto
 {
 std::string getSignature(bytes const &secretKey, std::string const &message);
 
+std::string getSignature(uint8_t const *secretKey, std::string const &message);
+
+// Writes SIGNATURE_LENGTH bytes to signature
+void getSignature(uint8_t const *secretKey, std::string const &message, uint8_t *signature);
+
 bytes getSeed(bytes const &secretKey);
 
 bytes getSecretKey(bytes const &seed);
 
 bytes getPublicKey(bytes const &secretKey);
 
+void getKeyPair(uint8_t const *seed, uint8_t *publicKey, uint8_t *secretKey);
+
 bool verify(std::string const &signature, std::string const &message, bytes const &publicKey);
 
+bool verify(std::string const &signature, std::string const &message, uint8_t const *publicKey);
+
+bool verify(std::string const &signature, std::string const &message, std::array<uint8_t, PUBLIC_KEY_LENGTH> const &publicKey);
+
 bytes scrypt(std::string const &password, KdfParams const &kdfParams);
 
 std::string hmacsha256(bytes const &key, std::string const &cipherText);
@@ -33,6 +43,34 @@ std::string hmacsha256(bytes const &key, std::string const &cipherText);
 bytes aes128ctrDecrypt(bytes const &key, std::string cipherText, std::string const &iv);
 
 std::string sha3Keccak(std::string const &message);
+
+// HMAC-SHA256 of the message, with a key of KEYED_HASH_KEY_BYTES bytes
+void keyedHash(uint8_t const *key, std::string const &message, uint8_t *hash);
+
+void randomBytes(uint8_t *buffer, std::size_t size);
+
+// Memory from sodium_malloc(): locked so that it is never swapped to disk, between guard pages, and zeroed when freed
+class SecureBuffer
+{
+public:
+    explicit SecureBuffer(std::size_t size);
+
+    ~SecureBuffer();
+
+    SecureBuffer(SecureBuffer const &) = delete;
+
+    SecureBuffer &operator=(SecureBuffer const &) = delete;
+
+    uint8_t *data();
+
+    uint8_t const *data() const;
+
+    std::size_t size() const;
+
+private:
+    uint8_t *m_data;
+    std::size_t m_size;
+};
 }
 }
 
@@ -0,0 +1,314 @@
+#ifndef ERD_WRAPPER_HTTP_RESILIENCE_H
+#define ERD_WRAPPER_HTTP_RESILIENCE_H
+
+#include <atomic>
+#include <random>
+#include <thread>
+
+#include "httpwrapper.h"
+#include "../utils/backoff.h"
+
+namespace wrapper
+{
+namespace http
+{
+
+// Failures worth retrying, possibly on another proxy: no response, 429 Too Many Requests, 502, 503 and 504.
+// 500 is not one of them, proxies answer invalid requests (e.g. a malformed address) with 500 and an error message.
+inline bool isTransientFailure(Result const &result)
+{
+    return result.error || result.status == 429 || result.status == 502 || result.status == 503 || result.status == 504;
+}
+
+struct ResiliencePolicy
+{
+    // Retries of a GET request after a transient failure, each on the next available endpoint. POST requests are
+    // never retried, a transaction that reached the proxy before the failure would be sent twice.
+    unsigned int maxRetries;
+    std::chrono::milliseconds initialBackoff;
+    std::chrono::milliseconds maxBackoff;
+    // Time budget of a request including its retries, 0 for none. Each attempt gets at most the remaining time as timeouts.
+    std::chrono::milliseconds deadline;
+    // Consecutive transient failures after which an endpoint is skipped for openDuration, 0 to never skip endpoints
+    unsigned int failureThreshold;
+    std::chrono::milliseconds openDuration;
+};
+
+// Circuit breaker of one endpoint. Closed: all requests go through. Open, after failureThreshold consecutive failures:
+// requests are refused for openDuration. Half open, afterwards: a single probe request goes through at a time,
+// its success closes the circuit and its failure opens it again.
+class CircuitBreaker
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    CircuitBreaker(unsigned int const failureThreshold, std::chrono::milliseconds const openDuration) :
+            m_failureThreshold(failureThreshold),
+            m_openDuration(openDuration),
+            m_numFailures(0),
+            m_probing(false)
+    {}
+
+    CircuitBreaker(CircuitBreaker const &) = delete;
+
+    CircuitBreaker &operator=(CircuitBreaker const &) = delete;
+
+    // Returns whether a request may be sent now. If so, its outcome must be reported with onSuccess() or onFailure(),
+    // or release() if it was not sent after all.
+    bool tryAcquire()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_failureThreshold == 0 || m_numFailures < m_failureThreshold)
+        {
+            return true;
+        }
+        if (Clock::now() < m_openUntil || m_probing)
+        {
+            return false;
+        }
+        m_probing = true;
+        return true;
+    }
+
+    void onSuccess()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_numFailures = 0;
+        m_probing = false;
+    }
+
+    void onFailure()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_numFailures;
+        if (m_failureThreshold != 0 && m_numFailures >= m_failureThreshold)
+        {
+            m_openUntil = Clock::now() + m_openDuration;
+            m_probing = false;
+        }
+    }
+
+    // Neither a success nor a failure: the request never reached the endpoint. A half open circuit may probe again.
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_probing = false;
+    }
+
+    bool isOpen() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_failureThreshold != 0 && m_numFailures >= m_failureThreshold;
+    }
+
+private:
+    unsigned int const m_failureThreshold;
+    std::chrono::milliseconds const m_openDuration;
+
+    mutable std::mutex m_mutex;
+    unsigned int m_numFailures;
+    bool m_probing;
+    Clock::time_point m_openUntil;
+};
+
+// Thread safe client of a list of equivalent endpoints (e.g. proxies of the same network), each with its own pool of
+// keep-alive connections and circuit breaker. Requests go to the first endpoint whose circuit is not open, so traffic
+// moves away from an endpoint that keeps failing or timing out and comes back once it recovers.
+// Failures are returned as a Result with error set, like ClientPool does; nothing is thrown.
+class ResilientClient
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    ResilientClient(std::vector<std::string> const &urls, std::size_t const maxConnections, std::chrono::milliseconds const idleTimeout,
+                    Timeouts const &timeouts, ResiliencePolicy const &policy) :
+            m_timeouts(timeouts),
+            m_policy(policy),
+            m_backoff(policy.initialBackoff, policy.maxBackoff),
+            m_numRetries(0)
+    {
+        for (std::string const &url: urls)
+        {
+            m_endpoints.emplace_back(new Endpoint(url, maxConnections, idleTimeout, timeouts, policy));
+        }
+    }
+
+    Result get(std::string const &path)
+    {
+        static thread_local std::mt19937 rng(std::random_device{}());
+        Clock::time_point const deadline = deadlineFromNow();
+
+        Result result{STATUS_CODE_DEFAULT, true, "", ERROR_MSG_HTTP_NO_ENDPOINT_AVAILABLE};
+        for (unsigned int retry = 0;; ++retry)
+        {
+            Timeouts timeouts;
+            if (!attemptTimeouts(deadline, timeouts))
+            {
+                return Result{STATUS_CODE_DEFAULT, true, "", ERROR_MSG_HTTP_DEADLINE_EXCEEDED};
+            }
+
+            // Once endpoints became unavailable, the failure of the last attempt says more than their circuits
+            Endpoint *const endpoint = acquireEndpoint(retry);
+            if (endpoint == nullptr)
+            {
+                return result;
+            }
+
+            result = send(*endpoint, [&]() { return endpoint->pool.get(path, timeouts, deadline); });
+            if (!isTransientFailure(result))
+            {
+                return result;
+            }
+
+            if (retry >= m_policy.maxRetries)
+            {
+                return result;
+            }
+
+            std::chrono::milliseconds const delay = m_backoff.delay(retry, rng);
+            if (hasDeadline() && Clock::now() + delay >= deadline)
+            {
+                return result;
+            }
+            ++m_numRetries;
+            std::this_thread::sleep_for(delay);
+        }
+    }
+
+    // Sent once, to the first available endpoint
+    Result post(std::string const &path, std::string const &message, ContentType const &contentType = applicationJson)
+    {
+        Clock::time_point const deadline = deadlineFromNow();
+        Timeouts timeouts;
+        if (!attemptTimeouts(deadline, timeouts))
+        {
+            return Result{STATUS_CODE_DEFAULT, true, "", ERROR_MSG_HTTP_DEADLINE_EXCEEDED};
+        }
+
+        Endpoint *const endpoint = acquireEndpoint(0);
+        if (endpoint == nullptr)
+        {
+            return Result{STATUS_CODE_DEFAULT, true, "", ERROR_MSG_HTTP_NO_ENDPOINT_AVAILABLE};
+        }
+
+        return send(*endpoint, [&]() { return endpoint->pool.post(path, message, contentType, timeouts, deadline); });
+    }
+
+    // Number of GET requests retried since construction
+    uint64_t numRetries() const
+    {
+        return m_numRetries;
+    }
+
+    // Whether the circuit of the i-th endpoint is open or half open
+    bool isOpen(std::size_t const endpoint) const
+    {
+        return m_endpoints.at(endpoint)->breaker.isOpen();
+    }
+
+private:
+    struct Endpoint
+    {
+        Endpoint(std::string const &url, std::size_t const maxConnections, std::chrono::milliseconds const idleTimeout,
+                 Timeouts const &timeouts, ResiliencePolicy const &policy) :
+                pool(url, maxConnections, idleTimeout, timeouts),
+                breaker(policy.failureThreshold, policy.openDuration)
+        {}
+
+        ClientPool pool;
+        CircuitBreaker breaker;
+    };
+
+    bool hasDeadline() const
+    {
+        return m_policy.deadline.count() > 0;
+    }
+
+    Clock::time_point deadlineFromNow() const
+    {
+        return hasDeadline() ? Clock::now() + m_policy.deadline : Clock::time_point::max();
+    }
+
+    // Retries start their search one endpoint further than the previous attempt, so that they go elsewhere
+    Endpoint *acquireEndpoint(unsigned int const retry)
+    {
+        for (std::size_t i = 0; i < m_endpoints.size(); ++i)
+        {
+            Endpoint &endpoint = *m_endpoints[(retry + i) % m_endpoints.size()];
+            if (endpoint.breaker.tryAcquire())
+            {
+                return &endpoint;
+            }
+        }
+        return nullptr;
+    }
+
+    // Result of ClientPool when no client was free before the deadline, the request was not sent
+    static bool isPoolTimeout(Result const &result)
+    {
+        return result.error && result.status == STATUS_CODE_DEFAULT && result.statusMessage == ERROR_MSG_HTTP_DEADLINE_EXCEEDED;
+    }
+
+    // Reports the outcome of the request to the circuit breaker of the endpoint. The pool throws if it can not create
+    // a client; this counts as a failure too, otherwise a half open circuit would wait for its probe forever.
+    // A deadline passed while waiting for a free client of the pool says nothing about the endpoint, which was
+    // not reached: it counts as neither, so that local load does not open the circuit of a healthy endpoint.
+    template<typename Request>
+    static Result send(Endpoint &endpoint, Request const &request)
+    {
+        Result result;
+        try
+        {
+            result = request();
+        }
+        catch (std::exception const &e)
+        {
+            result = Result{STATUS_CODE_DEFAULT, true, "", ERROR_MSG_HTTP_NO_RESPONSE + e.what()};
+        }
+
+        if (isPoolTimeout(result))
+        {
+            endpoint.breaker.release();
+        }
+        else if (isTransientFailure(result))
+        {
+            endpoint.breaker.onFailure();
+        }
+        else
+        {
+            endpoint.breaker.onSuccess();
+        }
+        return result;
+    }
+
+    // Shortens the timeouts to the time left. Returns false if there is none left.
+    bool attemptTimeouts(Clock::time_point const deadline, Timeouts &timeouts) const
+    {
+        timeouts = m_timeouts;
+        if (!hasDeadline())
+        {
+            return true;
+        }
+
+        auto const remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now());
+        if (remaining.count() <= 0)
+        {
+            return false;
+        }
+
+        timeouts.connection = std::min(timeouts.connection, remaining);
+        timeouts.read = std::min(timeouts.read, remaining);
+        timeouts.write = std::min(timeouts.write, remaining);
+        return true;
+    }
+
+    Timeouts const m_timeouts;
+    ResiliencePolicy const m_policy;
+    util::Backoff const m_backoff;
+    std::vector<std::unique_ptr<Endpoint>> m_endpoints;
+    std::atomic<uint64_t> m_numRetries;
+};
+
+} // http
+} // wrapper
+#endif
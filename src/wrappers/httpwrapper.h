@@ -1,7 +1,15 @@
 #ifndef ERD_WRAPPER_HTTP_H
 #define ERD_WRAPPER_HTTP_H
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "http/httplib.h"
+#include "../utils/errors.h"
 
 #define STATUS_CODE_DEFAULT -1
 #define STATUS_CODE_OK 200
@@ -19,6 +27,13 @@ enum ContentType
     applicationJson
 };
 
+struct Timeouts
+{
+    std::chrono::milliseconds connection;
+    std::chrono::milliseconds read;
+    std::chrono::milliseconds write;
+};
+
 struct Result
 {
     int status;
@@ -33,6 +48,20 @@ public:
     explicit Client(std::string const &url) : m_client(url.c_str())
     {}
 
+    Client(std::string const &url, Timeouts const &timeouts, bool const keepAlive) : m_client(url.c_str())
+    {
+        setTimeouts(timeouts);
+        m_client.set_keep_alive(keepAlive);
+        m_client.set_tcp_nodelay(true);
+    }
+
+    void setTimeouts(Timeouts const &timeouts)
+    {
+        m_client.set_connection_timeout(timeouts.connection);
+        m_client.set_read_timeout(timeouts.read);
+        m_client.set_write_timeout(timeouts.write);
+    }
+
     Result get(std::string const &path)
     {
         auto const res = m_client.Get(path.c_str());
@@ -83,7 +112,9 @@ private:
             err = error(res);
         }
 
-        return Result{status, err, body, getStatusMessage(status)};
+        // Without a response there is no status to describe, the transport error tells what went wrong
+        std::string statusMessage = err ? (ERROR_MSG_HTTP_NO_RESPONSE + httplib::to_string(res.error())) : getStatusMessage(status);
+        return Result{status, err, body, std::move(statusMessage)};
     }
 
     bool error(httplib::Result const &res) const
@@ -99,6 +130,173 @@ private:
     httplib::Client m_client;
 };
 
+// Thread safe pool of keep-alive clients to the same url. Each request borrows a client for its whole duration,
+// so at most maxConnections requests are in flight and further callers wait for a client to be returned.
+class ClientPool
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    ClientPool(std::string url, std::size_t const maxConnections, std::chrono::milliseconds const idleTimeout, Timeouts const &timeouts) :
+            m_url(std::move(url)),
+            m_maxConnections(std::max<std::size_t>(maxConnections, 1U)),
+            m_idleTimeout(idleTimeout),
+            m_timeouts(timeouts),
+            m_numLeased(0)
+    {}
+
+    Result get(std::string const &path)
+    {
+        Lease lease(*this);
+        return lease.client().get(path);
+    }
+
+    Result post(std::string const &path, std::string const &message, ContentType const &contentType = applicationJson)
+    {
+        Lease lease(*this);
+        return lease.client().post(path, message, contentType);
+    }
+
+    // Same as get(path), with other timeouts for this request only. If no client is free before deadline,
+    // the request is not sent and an error is returned.
+    Result get(std::string const &path, Timeouts const &timeouts, Clock::time_point const deadline = Clock::time_point::max())
+    {
+        Lease lease(*this, deadline);
+        if (!lease.acquired())
+        {
+            return Result{STATUS_CODE_DEFAULT, true, "", ERROR_MSG_HTTP_DEADLINE_EXCEEDED};
+        }
+        lease.client().setTimeouts(timeouts);
+        Result result = lease.client().get(path);
+        lease.client().setTimeouts(m_timeouts);
+        return result;
+    }
+
+    Result post(std::string const &path, std::string const &message, ContentType const &contentType, Timeouts const &timeouts,
+                Clock::time_point const deadline = Clock::time_point::max())
+    {
+        Lease lease(*this, deadline);
+        if (!lease.acquired())
+        {
+            return Result{STATUS_CODE_DEFAULT, true, "", ERROR_MSG_HTTP_DEADLINE_EXCEEDED};
+        }
+        lease.client().setTimeouts(timeouts);
+        Result result = lease.client().post(path, message, contentType);
+        lease.client().setTimeouts(m_timeouts);
+        return result;
+    }
+
+private:
+    struct IdleClient
+    {
+        std::unique_ptr<Client> client;
+        Clock::time_point lastUsed;
+    };
+
+    class Lease
+    {
+    public:
+        explicit Lease(ClientPool &pool, Clock::time_point const deadline = Clock::time_point::max()) :
+                m_pool(pool),
+                m_client(pool.acquire(deadline))
+        {}
+
+        ~Lease()
+        {
+            if (m_client)
+            {
+                m_pool.release(std::move(m_client));
+            }
+        }
+
+        Lease(Lease const &) = delete;
+
+        Lease &operator=(Lease const &) = delete;
+
+        // False if the deadline passed before a client was free
+        bool acquired() const
+        {
+            return m_client != nullptr;
+        }
+
+        Client &client()
+        {
+            return *m_client;
+        }
+
+    private:
+        ClientPool &m_pool;
+        std::unique_ptr<Client> m_client;
+    };
+
+    // Returns nullptr if no client is free before deadline
+    std::unique_ptr<Client> acquire(Clock::time_point const deadline)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto const isFree = [this]() { return m_numLeased < m_maxConnections; };
+        if (deadline == Clock::time_point::max())
+        {
+            m_available.wait(lock, isFree);
+        }
+        else if (!m_available.wait_until(lock, deadline, isFree))
+        {
+            return nullptr;
+        }
+        ++m_numLeased;
+
+        // Idle clients are kept oldest first. Connections idle for too long were most likely closed by the server,
+        // dropping them avoids a failed write on a dead socket.
+        Clock::time_point const now = Clock::now();
+        auto firstFresh = m_idle.begin();
+        while (firstFresh != m_idle.end() && now - firstFresh->lastUsed > m_idleTimeout)
+        {
+            ++firstFresh;
+        }
+        m_idle.erase(m_idle.begin(), firstFresh);
+
+        if (!m_idle.empty())
+        {
+            std::unique_ptr<Client> client = std::move(m_idle.back().client);
+            m_idle.pop_back();
+            return client;
+        }
+
+        lock.unlock();
+        try
+        {
+            return std::unique_ptr<Client>(new Client(m_url, m_timeouts, true));
+        }
+        catch (...)
+        {
+            release(nullptr);
+            throw;
+        }
+    }
+
+    void release(std::unique_ptr<Client> client)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (client)
+            {
+                m_idle.push_back(IdleClient{std::move(client), Clock::now()});
+            }
+            --m_numLeased;
+        }
+        m_available.notify_one();
+    }
+
+    std::string const m_url;
+    std::size_t const m_maxConnections;
+    std::chrono::milliseconds const m_idleTimeout;
+    Timeouts const m_timeouts;
+
+    std::mutex m_mutex;
+    std::condition_variable m_available;
+    std::vector<IdleClient> m_idle;
+    std::size_t m_numLeased;
+};
+
 } // http
 } // wrapper
 #endif
@@ -21,8 +21,9 @@ inline void set(nlohmann::ordered_json &json, std::string const &key, T const &v
 template<>
 inline void set<bytes>(nlohmann::ordered_json &json, std::string const &key, bytes const &value)
 {
-    std::string const val(value.begin(), value.end());
-    json[key] = util::base64::encode(val);
+    std::string encoded;
+    util::base64::encode(value.data(), value.size(), encoded);
+    json[key] = std::move(encoded);
 }
 
 template<class T>
@@ -34,10 +35,14 @@ inline T at(nlohmann::ordered_json const &json, std::string const &key)
 template<>
 inline bytes at<bytes>(nlohmann::ordered_json const &json, std::string const &key)
 {
-    std::string const tmp = json.at(key);
-    std::string const val = util::base64::decode(tmp);
+    std::string const &encoded = json.at(key).get_ref<std::string const &>();
+    bytes val(util::base64::decodedLength(encoded.data(), encoded.size()));
+    if (!val.empty())
+    {
+        util::base64::decode(encoded.data(), encoded.size(), val.data());
+    }
 
-    return bytes(val.begin(), val.end());
+    return val;
 }
 
 }
@@ -0,0 +1,82 @@
+#include "benchmark_common.h"
+
+#include "utils/bits.h"
+#include "bech32/bech32.h"
+#include "account/address.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+std::vector<Address> createAddresses(std::size_t const count)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+
+    std::vector<Address> addresses;
+    addresses.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Address::PublicKey publicKey;
+        for (auto &byte: publicKey)
+        {
+            byte = uint8_t(byteDistribution(rng));
+        }
+        addresses.emplace_back(publicKey);
+    }
+
+    return addresses;
+}
+
+void benchmarkEncode(std::vector<Address> const &addresses)
+{
+    double const secondsGeneric = benchmark::measureSeconds([&]()
+    {
+        for (auto const &address: addresses)
+        {
+            bytes const pk(address.getPublicKey().begin(), address.getPublicKey().end());
+            benchmark::doNotOptimize(util::bech32::encode("erd", util::convertBits(pk, 8, 5, true)));
+        }
+    });
+    benchmark::report("encode, generic bech32 + convertBits", addresses.size(), secondsGeneric);
+
+    double const seconds = benchmark::measureSeconds([&]()
+    {
+        benchmark::doNotOptimize(Address::toBech32(addresses));
+    });
+    benchmark::report("Address::toBech32()", addresses.size(), seconds);
+}
+
+void benchmarkDecode(std::vector<std::string> const &bech32Addresses)
+{
+    double const secondsGeneric = benchmark::measureSeconds([&]()
+    {
+        for (auto const &bech32Address: bech32Addresses)
+        {
+            auto const decoded = util::bech32::decode(bech32Address);
+            benchmark::doNotOptimize(util::convertBits(decoded.second, 5, 8, false));
+        }
+    });
+    benchmark::report("decode, generic bech32 + convertBits", bech32Addresses.size(), secondsGeneric);
+
+    double const seconds = benchmark::measureSeconds([&]()
+    {
+        benchmark::doNotOptimize(Address::fromBech32(bech32Addresses));
+    });
+    benchmark::report("Address::fromBech32()", bech32Addresses.size(), seconds);
+}
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const count = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+
+    std::vector<Address> const addresses = createAddresses(count);
+    std::vector<std::string> const bech32Addresses = Address::toBech32(addresses);
+
+    benchmarkEncode(addresses);
+    benchmarkDecode(bech32Addresses);
+
+    return 0;
+}
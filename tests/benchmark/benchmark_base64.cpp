@@ -0,0 +1,78 @@
+#include "benchmark_common.h"
+
+#include "utils/base64.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+std::string createData(std::size_t const size)
+{
+    std::mt19937 rng(42);
+    std::string data(size, '\0');
+    for (char &c: data)
+    {
+        c = char(rng() & 0xFF);
+    }
+    return data;
+}
+
+void benchmarkSize(std::size_t const size, std::size_t const count)
+{
+    std::string const data = createData(size);
+    std::string const encoded = util::base64::encode(data);
+    std::string const suffix = " (" + std::to_string(size) + " bytes)";
+
+    double const secondsEncode = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(util::base64::encode(data));
+        }
+    });
+    benchmark::report("encode(string)" + suffix, count, secondsEncode);
+
+    std::vector<char> encodeBuffer(util::base64::encodedLength(size));
+    double const secondsEncodeInto = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            util::base64::encode(reinterpret_cast<unsigned char const *>(data.data()), size, encodeBuffer.data());
+            benchmark::doNotOptimize(encodeBuffer);
+        }
+    });
+    benchmark::report("encode into buffer" + suffix, count, secondsEncodeInto);
+
+    double const secondsDecode = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(util::base64::decode(encoded));
+        }
+    });
+    benchmark::report("decode(string)" + suffix, count, secondsDecode);
+
+    std::vector<unsigned char> decodeBuffer(size);
+    double const secondsDecodeInto = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(util::base64::decode(encoded.data(), encoded.size(), decodeBuffer.data()));
+        }
+    });
+    benchmark::report("decode into buffer" + suffix, count, secondsDecodeInto);
+}
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const count = (argc > 1) ? std::stoul(argv[1]) : 100000;
+
+    // Typical transaction data fields, a PEM key and a contract deploy payload
+    benchmarkSize(32, count);
+    benchmarkSize(256, count);
+    benchmarkSize(64 * 1024, count / 100 + 1);
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include "benchmark_common.h"
+
+#include "internal/biguint.h"
+#include "bigint/integer.h"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace
+{
+// The previous BigUInt kept a decimal string and round-tripped every operation through the external integer
+namespace legacy
+{
+std::string add(std::string const &lhs, std::string const &rhs)
+{
+    std::string const result = (integer(lhs, 10) + integer(rhs, 10)).str();
+    integer const validate(result, 10);
+    return result;
+}
+
+bool less(std::string const &lhs, std::string const &rhs)
+{
+    return integer(lhs, 10) < integer(rhs, 10);
+}
+
+std::string multiply(std::string const &lhs, std::string const &rhs)
+{
+    std::string const result = (integer(lhs, 10) * integer(rhs, 10)).str();
+    integer const validate(result, 10);
+    return result;
+}
+}
+
+// Balances in the smallest denomination, 18 decimals
+std::vector<std::string> createBalances(std::size_t const count)
+{
+    std::mt19937_64 rng(42);
+    std::vector<std::string> balances;
+    balances.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        balances.push_back(std::to_string(rng() % 100000) + std::to_string(1000000000000000000ULL + rng() % 1000000000000000000ULL).substr(1));
+    }
+
+    return balances;
+}
+
+void benchmarkOperation(std::string const &name,
+                        std::vector<std::string> const &balances,
+                        std::size_t const legacyCount,
+                        std::function<void(std::string const &, std::string const &)> const &legacyOp,
+                        std::function<void(BigUInt const &, BigUInt const &)> const &op)
+{
+    std::vector<BigUInt> values;
+    values.reserve(balances.size());
+    for (auto const &balance: balances)
+    {
+        values.emplace_back(balance);
+    }
+
+    double const legacySeconds = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i + 1 < legacyCount; ++i)
+        {
+            legacyOp(balances[i], balances[i + 1]);
+        }
+    });
+    benchmark::report(name + ", string-backed (previous)", legacyCount - 1, legacySeconds);
+
+    double const seconds = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i + 1 < values.size(); ++i)
+        {
+            op(values[i], values[i + 1]);
+        }
+    });
+    benchmark::report(name + ", limb-based", values.size() - 1, seconds);
+}
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const count = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+    // The previous implementation is orders of magnitude slower, keep its run short
+    std::size_t const legacyCount = std::min<std::size_t>(count, 20);
+
+    std::vector<std::string> const balances = createBalances(count);
+
+    double const legacyParseSeconds = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < legacyCount; ++i)
+        {
+            benchmark::doNotOptimize(integer(balances[i], 10));
+        }
+    });
+    benchmark::report("parse, string-backed (previous)", legacyCount, legacyParseSeconds);
+
+    double const parseSeconds = benchmark::measureSeconds([&]()
+    {
+        for (auto const &balance: balances)
+        {
+            benchmark::doNotOptimize(BigUInt(balance));
+        }
+    });
+    benchmark::report("parse, limb-based", balances.size(), parseSeconds);
+
+    benchmarkOperation("add", balances, legacyCount,
+                       [](std::string const &a, std::string const &b) { benchmark::doNotOptimize(legacy::add(a, b)); },
+                       [](BigUInt const &a, BigUInt const &b) { benchmark::doNotOptimize(a + b); });
+
+    benchmarkOperation("compare", balances, legacyCount,
+                       [](std::string const &a, std::string const &b) { benchmark::doNotOptimize(legacy::less(a, b)); },
+                       [](BigUInt const &a, BigUInt const &b) { benchmark::doNotOptimize(a < b); });
+
+    benchmarkOperation("multiply", balances, legacyCount,
+                       [](std::string const &a, std::string const &b) { benchmark::doNotOptimize(legacy::multiply(a, b)); },
+                       [](BigUInt const &a, BigUInt const &b) { benchmark::doNotOptimize(a * b); });
+
+    std::vector<BigUInt> values;
+    values.reserve(balances.size());
+    for (auto const &balance: balances)
+    {
+        values.emplace_back(balance);
+    }
+
+    double const sumBinarySeconds = benchmark::measureSeconds([&]()
+    {
+        BigUInt total(0);
+        for (auto const &value: values)
+        {
+            total = total + value;
+        }
+        benchmark::doNotOptimize(total);
+    });
+    benchmark::report("sum, total = total + value", values.size(), sumBinarySeconds);
+
+    double const sumSeconds = benchmark::measureSeconds([&]()
+    {
+        benchmark::doNotOptimize(BigUInt::sum(values.begin(), values.end()));
+    });
+    benchmark::report("sum, BigUInt::sum (in place)", values.size(), sumSeconds);
+
+    benchmarkOperation("to decimal", balances, legacyCount,
+                       [](std::string const &a, std::string const &) { benchmark::doNotOptimize(a); },
+                       [](BigUInt const &a, BigUInt const &) { benchmark::doNotOptimize(a.getValue()); });
+
+    return 0;
+}
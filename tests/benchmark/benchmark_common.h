@@ -0,0 +1,37 @@
+#ifndef ERDCPP_BENCHMARK_COMMON_H
+#define ERDCPP_BENCHMARK_COMMON_H
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace benchmark
+{
+// Runs func once and returns the elapsed wall time in seconds
+template<typename Func>
+double measureSeconds(Func func)
+{
+    auto const start = std::chrono::steady_clock::now();
+    func();
+    auto const end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double>(end - start).count();
+}
+
+inline void report(std::string const &name, std::size_t const numOperations, double const seconds)
+{
+    double const opsPerSecond = (seconds > 0) ? (double(numOperations) / seconds) : 0;
+    double const nsPerOperation = (numOperations > 0) ? (seconds * 1e9 / double(numOperations)) : 0;
+
+    std::printf("%-60s %12.0f ops/s %12.1f ns/op\n", name.c_str(), opsPerSecond, nsPerOperation);
+}
+
+// Prevents the compiler from optimizing away a computed value
+template<typename T>
+inline void doNotOptimize(T const &value)
+{
+    asm volatile("" : : "m"(value) : "memory");
+}
+}
+
+#endif //ERDCPP_BENCHMARK_COMMON_H
@@ -0,0 +1,76 @@
+#include "benchmark_common.h"
+
+#include "transaction/transaction_factory.h"
+
+namespace
+{
+std::string const token = "WEGLD-bd4d79";
+Address const sender("erd1l453hd0gt5gzdp7czpuall8ggt2dcv5zwmfdf3sd3lguxseux2fsmsgldz");
+uint64_t const gasPrice = 1000000000;
+
+// Payout of count transfers to a few receivers, with varying amounts
+std::vector<ESDTTransferTarget> createTargets(std::size_t const count)
+{
+    std::vector<Address> const receivers = {
+            Address("erd1cux02zersde0l7hhklzhywcxk4u9n4py5tdxyx7vrvhnza2r4gmq4vw35r"),
+            Address("erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th"),
+            Address("erd1qqqqqqqqqqqqqpgqrc4pg2xarca9z34njcxeur622qmfjp8w2jps89fxnl")};
+
+    std::vector<ESDTTransferTarget> targets;
+    targets.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        targets.push_back(ESDTTransferTarget{i, receivers[i % receivers.size()], BigUInt(1000000000000000000ULL + i)});
+    }
+    return targets;
+}
+
+void benchmarkBuild(std::size_t const count)
+{
+    NetworkConfig const networkConfig = DEFAULT_MAINNET_NETWORK_CONFIG;
+    TransactionFactory factory(networkConfig);
+    std::vector<ESDTTransferTarget> const targets = createTargets(count);
+
+    std::vector<Transaction> transactions;
+    transactions.reserve(count);
+    double const secondsFactory = benchmark::measureSeconds([&]()
+    {
+        for (ESDTTransferTarget const &target: targets)
+        {
+            transactions.push_back(factory
+                                           .createESDTTransfer(TokenPayment::fungibleFromBigUInt(token, target.amount), target.nonce,
+                                                               sender, target.receiver, gasPrice)
+                                           ->build());
+        }
+    });
+    benchmark::report("TransactionFactory::createESDTTransfer()->build()", count, secondsFactory);
+
+    ESDTTransferTemplate const txTemplate = factory.createESDTTransferTemplate(token, sender, gasPrice);
+
+    std::vector<Transaction> fresh;
+    double const secondsTemplate = benchmark::measureSeconds([&]()
+    {
+        txTemplate.build(targets, fresh);
+    });
+    benchmark::report("ESDTTransferTemplate::build(), new vector", count, secondsTemplate);
+
+    // Next payout built into the same vector, reusing the buffers of the previous one
+    double const secondsReused = benchmark::measureSeconds([&]()
+    {
+        txTemplate.build(targets, fresh);
+    });
+    benchmark::report("ESDTTransferTemplate::build(), reused vector", count, secondsReused);
+
+    benchmark::doNotOptimize(transactions);
+    benchmark::doNotOptimize(fresh);
+}
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const count = (argc > 1) ? std::stoul(argv[1]) : 100000;
+
+    benchmarkBuild(count);
+
+    return 0;
+}
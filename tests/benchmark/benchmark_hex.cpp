@@ -0,0 +1,93 @@
+#include "benchmark_common.h"
+
+#include "utils/hex.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+// Byte pair by byte pair decoding util::hexToBytes used to do
+bytes legacyHexToBytes(std::string const &hex)
+{
+    bytes ret;
+    for (unsigned int i = 0; i < hex.length(); i += 2)
+    {
+        std::string byteString = hex.substr(i, 2);
+        ret.push_back(uint8_t(strtol(byteString.c_str(), nullptr, 16)));
+    }
+    return ret;
+}
+
+void benchmarkSize(std::size_t const size, std::size_t const count)
+{
+    std::mt19937 rng(42);
+    std::string data(size, '\0');
+    for (char &c: data)
+    {
+        c = char(rng() & 0xFF);
+    }
+    std::string const hex = util::stringToHex(data);
+    std::string const suffix = " (" + std::to_string(size) + " bytes)";
+
+    double const secondsEncode = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(util::stringToHex(data));
+        }
+    });
+    benchmark::report("stringToHex()" + suffix, count, secondsEncode);
+
+    std::vector<char> hexBuffer(2 * size);
+    double const secondsEncodeInto = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            util::bytesToHex(reinterpret_cast<uint8_t const *>(data.data()), size, hexBuffer.data());
+            benchmark::doNotOptimize(hexBuffer);
+        }
+    });
+    benchmark::report("bytesToHex() into buffer" + suffix, count, secondsEncodeInto);
+
+    double const secondsLegacyDecode = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(legacyHexToBytes(hex));
+        }
+    });
+    benchmark::report("hexToBytes(), legacy substr + strtol" + suffix, count, secondsLegacyDecode);
+
+    double const secondsDecode = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(util::hexToBytes(hex));
+        }
+    });
+    benchmark::report("hexToBytes()" + suffix, count, secondsDecode);
+
+    std::vector<uint8_t> byteBuffer(size);
+    double const secondsDecodeInto = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(util::hexToBytes(hex.data(), hex.size(), byteBuffer.data()));
+        }
+    });
+    benchmark::report("hexToBytes() into buffer" + suffix, count, secondsDecodeInto);
+}
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const count = (argc > 1) ? std::stoul(argv[1]) : 100000;
+
+    // Keys and hashes, signatures and a large SC argument
+    benchmarkSize(32, count);
+    benchmarkSize(64, count);
+    benchmarkSize(16 * 1024, count / 100 + 1);
+
+    return 0;
+}
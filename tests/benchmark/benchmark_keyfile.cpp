@@ -0,0 +1,57 @@
+#include "benchmark_common.h"
+#include "test_common.h"
+
+#include "filehandler/keyfilereader.h"
+#include "filehandler/keyfileloader.h"
+#include "utils/parallel.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+// The key files of tests/testData, repeated to the number of keystores of a signing service
+std::vector<KeyFileCredentials> createFiles(std::size_t const count)
+{
+    std::vector<std::string> const names = {"aliceKeyFile.json", "bobKeyFile.json", "carolKeyFile.json"};
+
+    std::vector<KeyFileCredentials> files;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        files.push_back(KeyFileCredentials{getCanonicalTestDataPath(names[i % names.size()]), "password"});
+    }
+    return files;
+}
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const count = (argc > 1) ? std::stoul(argv[1]) : 96;
+    std::vector<KeyFileCredentials> const files = createFiles(count);
+
+    double const secondsSequential = benchmark::measureSeconds([&]()
+    {
+        for (KeyFileCredentials const &file: files)
+        {
+            benchmark::doNotOptimize(KeyFileReader(file.filePath, file.password).getSeed());
+        }
+    });
+    benchmark::report("KeyFileReader, one after another", files.size(), secondsSequential);
+
+    double const secondsParallel = benchmark::measureSeconds([&]()
+    {
+        benchmark::doNotOptimize(KeyFileLoader().load(files));
+    });
+    benchmark::report("KeyFileLoader, " + std::to_string(util::defaultNumThreads()) + " threads", files.size(), secondsParallel);
+
+    auto const cache = std::make_shared<KeyFileCache>();
+    KeyFileLoader const cachedLoader(0, cache);
+    cachedLoader.load(files);
+    double const secondsCached = benchmark::measureSeconds([&]()
+    {
+        benchmark::doNotOptimize(cachedLoader.load(files));
+    });
+    benchmark::report("KeyFileLoader, unlocked before (cache)", files.size(), secondsCached);
+
+    return 0;
+}
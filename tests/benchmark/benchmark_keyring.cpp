@@ -0,0 +1,96 @@
+#include "benchmark_common.h"
+
+#include "transaction/keyring.h"
+
+#include <cstring>
+
+namespace
+{
+std::string const receiver = "erd1cux02zersde0l7hhklzhywcxk4u9n4py5tdxyx7vrvhnza2r4gmq4vw35r";
+
+bytes seedOf(std::size_t const i)
+{
+    bytes seed(SEED_LENGTH, 0);
+    std::memcpy(seed.data(), &i, sizeof(i));
+    return seed;
+}
+
+// Payouts of numSenders custodial wallets, senders taking turns
+std::vector<Transaction> createTransactions(std::vector<Address> const &senders, std::size_t const count)
+{
+    std::vector<Transaction> transactions(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Transaction &tx = transactions[i];
+        tx.m_nonce = i;
+        tx.m_value = BigUInt(1000000000000000000ULL);
+        tx.m_sender = std::make_shared<Address>(senders[i % senders.size()]);
+        tx.m_receiver = std::make_shared<Address>(receiver);
+        tx.m_gasPrice = 1000000000;
+        tx.m_gasLimit = 50000;
+    }
+    return transactions;
+}
+
+void benchmarkSign(std::size_t const numSenders, std::size_t const count)
+{
+    std::vector<bytes> seeds;
+    std::vector<Address> senders;
+    KeyRing keyRing;
+    for (std::size_t i = 0; i < numSenders; ++i)
+    {
+        seeds.push_back(seedOf(i));
+        keyRing.add(seeds.back());
+        senders.push_back(Signer(seeds.back()).getAddress());
+    }
+
+    std::string const suffix = ", " + std::to_string(numSenders) + " senders";
+
+    // Previous behaviour, like cli::utility::signTransaction: a Signer is derived from the sender's seed for each transaction
+    std::vector<Transaction> transactions = createTransactions(senders, count);
+    double const secondsPerTransaction = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            transactions[i].sign(Signer(seeds[i % numSenders]));
+        }
+    });
+    benchmark::report("Signer built per transaction" + suffix, count, secondsPerTransaction);
+
+    transactions = createTransactions(senders, count);
+    double const secondsKeyRing = benchmark::measureSeconds([&]()
+    {
+        for (Transaction &tx: transactions)
+        {
+            keyRing.sign(tx);
+        }
+    });
+    benchmark::report("KeyRing::sign()" + suffix, count, secondsKeyRing);
+
+    transactions = createTransactions(senders, count);
+    double const secondsBatch = benchmark::measureSeconds([&]()
+    {
+        benchmark::doNotOptimize(keyRing.signBatch(transactions));
+    });
+    benchmark::report("KeyRing::signBatch()" + suffix, count, secondsBatch);
+
+    double const secondsFind = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(keyRing.find(senders[i % numSenders]));
+        }
+    });
+    benchmark::report("KeyRing::find()" + suffix, count, secondsFind);
+}
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const count = (argc > 1) ? std::stoul(argv[1]) : 20000;
+
+    benchmarkSign(10, count);
+    benchmarkSign(10000, count);
+
+    return 0;
+}
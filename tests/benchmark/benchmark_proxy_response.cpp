@@ -0,0 +1,75 @@
+#include "benchmark_common.h"
+
+#include "provider/apiresponse.h"
+#include "provider/response_reader.h"
+
+namespace
+{
+// /address/:bech32/esdt response of an account holding numTokens tokens, each with a few attributes
+std::string createEsdtsResponse(std::size_t const numTokens)
+{
+    std::string body = R"({"data":{"blockInfo":{"nonce":1234,"hash":"abcd"},"esdts":{)";
+    for (std::size_t i = 0; i < numTokens; ++i)
+    {
+        std::string const token = "TKN" + std::to_string(i) + "-6258d2";
+        if (i > 0) body += ',';
+        body += '"' + token + R"(":{"tokenIdentifier":")" + token + R"(","balance":")" + std::to_string(i + 1) +
+                R"(000000000000000000","properties":"","creator":"","royalties":"0","uris":["aHR0cHM6Ly9leGFtcGxlLmNvbQ=="]})";
+    }
+    body += R"(}},"error":"","code":"successful"})";
+    return body;
+}
+
+// Field extraction ProxyProvider used before streaming: a json tree of the whole response, then a copy of "data"
+std::map<std::string, BigUInt> readAllESDTBalancesDom(std::string const &body)
+{
+    ErdGenericApiResponse response(body);
+    response.checkSuccessfulOperation();
+    auto data = response.getData<nlohmann::json>();
+    utility::requireAttribute(data, "esdts");
+
+    std::map<std::string, BigUInt> ret;
+    for (auto const &it: data["esdts"].items())
+    {
+        utility::requireAttribute(it.value(), "balance");
+        std::string const balance = it.value()["balance"];
+        ret.emplace(it.key(), BigUInt(balance));
+    }
+    return ret;
+}
+
+void benchmarkTokens(std::size_t const numTokens, std::size_t const count)
+{
+    std::string const body = createEsdtsResponse(numTokens);
+    std::string const suffix = " (" + std::to_string(numTokens) + " tokens, " + std::to_string(body.size() / 1024) + " KiB)";
+
+    double const secondsDom = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(readAllESDTBalancesDom(body));
+        }
+    });
+    benchmark::report("json tree" + suffix, count, secondsDom);
+
+    double const secondsStreaming = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(internal::readAllESDTBalances(body));
+        }
+    });
+    benchmark::report("streaming" + suffix, count, secondsStreaming);
+}
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const count = (argc > 1) ? std::stoul(argv[1]) : 1000;
+
+    benchmarkTokens(10, count);
+    benchmarkTokens(1000, count / 10 + 1);
+    benchmarkTokens(20000, count / 100 + 1);
+
+    return 0;
+}
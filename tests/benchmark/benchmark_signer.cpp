@@ -0,0 +1,77 @@
+#include "benchmark_common.h"
+
+#include "utils/hex.h"
+#include "transaction/signer.h"
+#include "wrappers/cryptosignwrapper.h"
+
+namespace
+{
+std::string const message = R"({"nonce":0,"value":"0","receiver":"erd1cux02zersde0l7hhklzhywcxk4u9n4py5tdxyx7vrvhnza2r4gmq4vw35r","sender":"erd1l453hd0gt5gzdp7czpuall8ggt2dcv5zwmfdf3sd3lguxseux2fsmsgldz","gasPrice":1000000000,"gasLimit":50000,"data":"Zm9v","chainID":"1","version":1})";
+bytes const seed = util::hexToBytes("1a927e2af5306a9bb2ea777f73e06ecc0ac9aaa72fb4ea3fecf659451394cccf");
+
+void benchmarkVerify(std::size_t const count)
+{
+    Signer const signer(seed);
+    std::string const signature = signer.getSignature(message);
+
+    // Previous behaviour: the public key was derived from the secret key on every call
+    bytes const secretKey = wrapper::crypto::getSecretKey(seed);
+    double const secondsRecomputed = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            bytes const publicKey = wrapper::crypto::getPublicKey(secretKey);
+            benchmark::doNotOptimize(wrapper::crypto::verify(signature, message, publicKey));
+        }
+    });
+    benchmark::report("verify, public key derived per call", count, secondsRecomputed);
+
+    double const secondsCached = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(signer.verify(signature, message));
+        }
+    });
+    benchmark::report("Signer::verify(), cached public key", count, secondsCached);
+}
+
+void benchmarkSign(std::size_t const count)
+{
+    Signer const signer(seed);
+
+    double const seconds = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(signer.getSignature(message));
+        }
+    });
+    benchmark::report("Signer::getSignature()", count, seconds);
+}
+
+void benchmarkGetAddress(std::size_t const count)
+{
+    Signer const signer(seed);
+
+    double const seconds = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            benchmark::doNotOptimize(signer.getAddress());
+        }
+    });
+    benchmark::report("Signer::getAddress()", count, seconds);
+}
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const count = (argc > 1) ? std::stoul(argv[1]) : 100000;
+
+    benchmarkVerify(count);
+    benchmarkSign(count);
+    benchmarkGetAddress(count);
+
+    return 0;
+}
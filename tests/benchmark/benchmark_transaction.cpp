@@ -0,0 +1,124 @@
+#include "benchmark_common.h"
+
+#include "utils/hex.h"
+#include "utils/parallel.h"
+#include "transaction/transaction.h"
+
+#include <vector>
+
+namespace
+{
+std::vector<Transaction> createTransactions(std::size_t const count)
+{
+    Transaction tx;
+    tx.m_value = BigUInt("10000000000000000000");
+    tx.m_receiver = std::make_shared<Address>("erd1cux02zersde0l7hhklzhywcxk4u9n4py5tdxyx7vrvhnza2r4gmq4vw35r");
+    tx.m_sender = std::make_shared<Address>("erd1l453hd0gt5gzdp7czpuall8ggt2dcv5zwmfdf3sd3lguxseux2fsmsgldz");
+    tx.m_gasPrice = 1000000000;
+    tx.m_gasLimit = 50000;
+    tx.m_data = std::make_shared<bytes>(util::hexToBytes("61697264726f70"));
+
+    std::vector<Transaction> transactions(count, tx);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        transactions[i].m_nonce = i;
+    }
+
+    return transactions;
+}
+
+void benchmarkSerialize(std::size_t const count)
+{
+    auto const transactions = createTransactions(count);
+
+    double const seconds = benchmark::measureSeconds([&]()
+    {
+        for (auto const &tx: transactions)
+        {
+            benchmark::doNotOptimize(tx.serialize());
+        }
+    });
+    benchmark::report("Transaction::serialize()", count, seconds);
+
+    std::string buffer;
+    double const secondsReusedBuffer = benchmark::measureSeconds([&]()
+    {
+        for (auto const &tx: transactions)
+        {
+            tx.serialize(buffer);
+            benchmark::doNotOptimize(buffer);
+        }
+    });
+    benchmark::report("Transaction::serialize(buffer)", count, secondsReusedBuffer);
+}
+
+void benchmarkSign(std::size_t const count)
+{
+    Signer const signer(util::hexToBytes("1a927e2af5306a9bb2ea777f73e06ecc0ac9aaa72fb4ea3fecf659451394cccf"));
+
+    auto transactions = createTransactions(count);
+    double const secondsSequential = benchmark::measureSeconds([&]()
+    {
+        for (auto &tx: transactions)
+        {
+            tx.sign(signer);
+        }
+    });
+    benchmark::report("Transaction::sign() loop", count, secondsSequential);
+
+    unsigned int const maxThreads = util::defaultNumThreads();
+    for (unsigned int numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        transactions = createTransactions(count);
+        double const seconds = benchmark::measureSeconds([&]()
+        {
+            Transaction::signBatch(transactions, signer, numThreads);
+        });
+
+        std::string const name = "Transaction::signBatch(), threads = " + std::to_string(numThreads) +
+                                 ", speedup = " + std::to_string(secondsSequential / seconds).substr(0, 4) + "x";
+        benchmark::report(name, count, seconds);
+    }
+}
+
+void benchmarkVerify(std::size_t const count)
+{
+    Signer const signer(util::hexToBytes("1a927e2af5306a9bb2ea777f73e06ecc0ac9aaa72fb4ea3fecf659451394cccf"));
+
+    auto transactions = createTransactions(count);
+    Transaction::signBatch(transactions, signer);
+
+    double const secondsSequential = benchmark::measureSeconds([&]()
+    {
+        for (auto &tx: transactions)
+        {
+            benchmark::doNotOptimize(tx.verify());
+        }
+    });
+    benchmark::report("Transaction::verify() loop", count, secondsSequential);
+
+    unsigned int const maxThreads = util::defaultNumThreads();
+    for (unsigned int numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        double const seconds = benchmark::measureSeconds([&]()
+        {
+            benchmark::doNotOptimize(Transaction::verifyBatch(transactions, numThreads));
+        });
+
+        std::string const name = "Transaction::verifyBatch(), threads = " + std::to_string(numThreads) +
+                                 ", speedup = " + std::to_string(secondsSequential / seconds).substr(0, 4) + "x";
+        benchmark::report(name, count, seconds);
+    }
+}
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const count = (argc > 1) ? std::stoul(argv[1]) : 100000;
+
+    benchmarkSerialize(count);
+    benchmarkSign(count);
+    benchmarkVerify(count);
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include "benchmark_common.h"
+
+#include "transaction/transaction_factory.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<std::size_t> numAllocations(0);
+}
+
+// Counts the heap allocations of this executable
+void *operator new(std::size_t const size)
+{
+    ++numAllocations;
+    if (void *const ptr = std::malloc(size != 0 ? size : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *const ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *const ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+Address const sender("erd1l453hd0gt5gzdp7czpuall8ggt2dcv5zwmfdf3sd3lguxseux2fsmsgldz");
+Address const receiver("erd1cux02zersde0l7hhklzhywcxk4u9n4py5tdxyx7vrvhnza2r4gmq4vw35r");
+uint64_t const gasPrice = 1000000000;
+
+// Reports time and heap allocations per transaction of func, called count times
+template<typename Func>
+void measure(std::string const &name, std::size_t const count, Func func)
+{
+    std::size_t const allocationsBefore = numAllocations;
+    double const seconds = benchmark::measureSeconds([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            func(i);
+        }
+    });
+    std::size_t const allocations = numAllocations - allocationsBefore;
+
+    benchmark::report(name, count, seconds);
+    std::printf("%-60s %12.1f allocations/op\n", "", double(allocations) / double(count));
+}
+
+void benchmarkEGLDTransfer(TransactionFactory &factory, std::size_t const count)
+{
+    measure("createEGLDTransfer()->build()", count, [&](std::size_t const i)
+    {
+        benchmark::doNotOptimize(factory.createEGLDTransfer(i, BigUInt(1000000000000000000ULL), sender, receiver, gasPrice, "payout")->build());
+    });
+
+    Transaction tx;
+    measure("buildEGLDTransfer(), reused transaction", count, [&](std::size_t const i)
+    {
+        factory.buildEGLDTransfer(tx, i, BigUInt(1000000000000000000ULL), sender, receiver, gasPrice, "payout");
+        benchmark::doNotOptimize(tx);
+    });
+}
+
+void benchmarkESDTTransfer(TransactionFactory &factory, std::size_t const count)
+{
+    TokenPayment const payment = TokenPayment::fungibleFromBigUInt("WEGLD-bd4d79", BigUInt(1000000000000000000ULL));
+
+    measure("createESDTTransfer()->build()", count, [&](std::size_t const i)
+    {
+        benchmark::doNotOptimize(factory.createESDTTransfer(payment, i, sender, receiver, gasPrice)->build());
+    });
+
+    Transaction tx;
+    measure("buildESDTTransfer(), reused transaction", count, [&](std::size_t const i)
+    {
+        factory.buildESDTTransfer(tx, payment, i, sender, receiver, gasPrice);
+        benchmark::doNotOptimize(tx);
+    });
+}
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const count = (argc > 1) ? std::stoul(argv[1]) : 100000;
+
+    NetworkConfig const networkConfig = DEFAULT_MAINNET_NETWORK_CONFIG;
+    TransactionFactory factory(networkConfig);
+
+    benchmarkEGLDTransfer(factory, count);
+    benchmarkESDTTransfer(factory, count);
+
+    return 0;
+}
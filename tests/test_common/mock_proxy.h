@@ -0,0 +1,87 @@
+#ifndef ERDCPP_MOCK_PROXY_H
+#define ERDCPP_MOCK_PROXY_H
+
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include "http/httplib.h"
+
+// Local stand-in for a MultiversX proxy, listening on a random port of the loopback interface.
+// Register handlers on server() before sending requests.
+class MockProxy
+{
+public:
+    MockProxy() :
+            m_numRequests(0)
+    {
+        m_server.set_pre_routing_handler([this](httplib::Request const &req, httplib::Response &)
+                                         {
+                                             std::lock_guard<std::mutex> lock(m_mutex);
+                                             m_clientPorts.insert(req.remote_port);
+                                             ++m_numRequests;
+                                             return httplib::Server::HandlerResponse::Unhandled;
+                                         });
+
+        // Real proxies keep connections open for many requests, httplib's default is only 5
+        m_server.set_keep_alive_max_count(1000);
+        m_server.set_tcp_nodelay(true);
+        m_port = m_server.bind_to_any_port("127.0.0.1");
+        m_thread = std::thread([this]() { m_server.listen_after_bind(); });
+        while (!m_server.is_running())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    ~MockProxy()
+    {
+        m_server.stop();
+        m_thread.join();
+    }
+
+    MockProxy(MockProxy const &) = delete;
+
+    MockProxy &operator=(MockProxy const &) = delete;
+
+    httplib::Server &server()
+    {
+        return m_server;
+    }
+
+    std::string url() const
+    {
+        return "http://127.0.0.1:" + std::to_string(m_port);
+    }
+
+    // Number of distinct client connections, identified by their source port
+    std::size_t numConnections() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_clientPorts.size();
+    }
+
+    std::size_t numRequests() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_numRequests;
+    }
+
+    // Wraps data in the generic proxy response envelope
+    static std::string successResponse(std::string const &data)
+    {
+        return R"({"data":)" + data + R"(,"error":"","code":"successful"})";
+    }
+
+private:
+    httplib::Server m_server;
+    std::thread m_thread;
+    int m_port;
+
+    mutable std::mutex m_mutex;
+    std::set<int> m_clientPorts;
+    std::size_t m_numRequests;
+};
+
+#endif //ERDCPP_MOCK_PROXY_H
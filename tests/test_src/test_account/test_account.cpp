@@ -4,6 +4,13 @@
 #include "utils/errors.h"
 #include "account/address.h"
 #include "account/account.h"
+#include "account/address_codec.h"
+#include "utils/bits.h"
+#include "bech32/bech32.h"
+
+#include <algorithm>
+#include <random>
+#include <unordered_set>
 
 class AddressConstructorFixture : public ::testing::Test
 {
@@ -122,6 +129,133 @@ TEST(Address, assignmentOperator)
     EXPECT_EQ(adr1, adr2);
 }
 
+TEST(Address, copyAndMove_keepCachedBech32)
+{
+    Address const original(util::hexToBytes("0139472eff6886771a982f3083da5d421f24c29181e63888228dc81ca60d69e1"));
+    std::string const bech32 = "erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th";
+
+    Address const copyBeforeEncoding(original);
+    EXPECT_EQ(original.getBech32Address(), bech32);
+    EXPECT_EQ(&original.getBech32Address(), &original.getBech32Address()); // cached
+    EXPECT_EQ(copyBeforeEncoding.getBech32Address(), bech32);
+
+    Address copy(original);
+    EXPECT_EQ(copy.getBech32Address(), bech32);
+    EXPECT_NE(&copy.getBech32Address(), &original.getBech32Address());
+
+    Address moved(std::move(copy));
+    EXPECT_EQ(moved.getBech32Address(), bech32);
+    EXPECT_EQ(moved, original);
+
+    Address assigned("erd1sjsk3n2d0krq3pyxxtgf0q7j3t56sgusqaujj4n82l39t9h7jers6gslr4");
+    EXPECT_NE(assigned, original);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.getBech32Address(), bech32);
+    assigned = assigned;
+    EXPECT_EQ(assigned.getBech32Address(), bech32);
+}
+
+TEST(Address, invalidBech32PayloadSize)
+{
+    // Valid bech32 string with "erd" hrp, but 20 bytes payload
+    EXPECT_THROW(Address("erd1qqqsyqcyq5rqwzqfpg9scrgwpugpzysnmxwrf2"), std::invalid_argument);
+}
+
+TEST(Address, hash)
+{
+    Address const adr1("erd1sjsk3n2d0krq3pyxxtgf0q7j3t56sgusqaujj4n82l39t9h7jers6gslr4");
+    Address const adr2(adr1.getPublicKey());
+    Address const adr3("erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th");
+
+    std::hash<Address> const hasher;
+    EXPECT_EQ(hasher(adr1), hasher(adr2));
+    EXPECT_NE(hasher(adr1), hasher(adr3));
+
+    std::unordered_set<Address> addresses{adr1, adr2, adr3};
+    EXPECT_EQ(addresses.size(), 2);
+    EXPECT_EQ(addresses.count(Address("erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th")), 1);
+}
+
+TEST(AddressCodec, sameAsGenericBech32)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        bytes publicKey(PUBLIC_KEY_LENGTH);
+        for (auto &byte: publicKey)
+        {
+            byte = uint8_t(byteDistribution(rng));
+        }
+        std::string const expected = util::bech32::encode("erd", util::convertBits(publicKey, 8, 5, true));
+
+        char encoded[BECH32_ADDRESS_LENGTH];
+        internal::encodeBech32Address(publicKey.data(), encoded);
+        EXPECT_EQ(std::string(encoded, BECH32_ADDRESS_LENGTH), expected);
+
+        bytes decoded(PUBLIC_KEY_LENGTH);
+        EXPECT_TRUE(internal::decodeBech32Address(expected.data(), expected.size(), decoded.data()));
+        EXPECT_EQ(decoded, publicKey);
+    }
+}
+
+TEST(AddressCodec, decodeInvalid)
+{
+    std::string const valid = "erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th";
+    bytes publicKey(PUBLIC_KEY_LENGTH);
+
+    std::string upper = valid;
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+    EXPECT_TRUE(internal::decodeBech32Address(upper.data(), upper.size(), publicKey.data()));
+    EXPECT_EQ(Address(upper), Address(valid));
+
+    std::string mixed = valid;
+    mixed[10] = char(::toupper(mixed[10]));
+    EXPECT_FALSE(internal::decodeBech32Address(mixed.data(), mixed.size(), publicKey.data()));
+
+    std::string badChecksum = valid;
+    badChecksum.back() = (badChecksum.back() == 'q') ? 'p' : 'q';
+    EXPECT_FALSE(internal::decodeBech32Address(badChecksum.data(), badChecksum.size(), publicKey.data()));
+
+    std::string badChar = valid;
+    badChar[20] = 'b'; // not in the bech32 charset
+    EXPECT_FALSE(internal::decodeBech32Address(badChar.data(), badChar.size(), publicKey.data()));
+
+    std::string const otherHrp = util::bech32::encode("abc", util::convertBits(bytes(PUBLIC_KEY_LENGTH, 1), 8, 5, true));
+    EXPECT_FALSE(internal::decodeBech32Address(otherHrp.data(), otherHrp.size(), publicKey.data()));
+
+    // Non zero padding bits in the last data character
+    bytes values = util::bech32::decode(valid).second;
+    values.back() |= 1;
+    std::string const badPadding = util::bech32::encode("erd", values);
+    EXPECT_FALSE(internal::decodeBech32Address(badPadding.data(), badPadding.size(), publicKey.data()));
+
+    EXPECT_FALSE(internal::decodeBech32Address(valid.data(), valid.size() - 1, publicKey.data()));
+    EXPECT_FALSE(internal::decodeBech32Address("", 0, publicKey.data()));
+}
+
+TEST(Address, bulkConversions)
+{
+    std::vector<std::string> const bech32Addresses = {
+            "erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th",
+            "erd1spyavw0956vq68xj8y4tenjpq2wd5a9p2c6j8gsz7ztyrnpxrruqzu66jx",
+            "erd1k2s324ww2g0yj38qn2ch2jwctdy8mnfxep94q9arncc6xecg3xaq6mjse8"};
+
+    std::vector<Address> const addresses = Address::fromBech32(bech32Addresses);
+    ASSERT_EQ(addresses.size(), bech32Addresses.size());
+    for (std::size_t i = 0; i < addresses.size(); ++i)
+    {
+        EXPECT_EQ(addresses[i], Address(bech32Addresses[i]));
+    }
+    addresses[1].getBech32Address(); // cached
+    EXPECT_EQ(Address::toBech32(addresses), bech32Addresses);
+
+    EXPECT_TRUE(Address::fromBech32({}).empty());
+    EXPECT_TRUE(Address::toBech32({}).empty());
+    EXPECT_THROW(Address::fromBech32({bech32Addresses[0], "erd1invalid"}), std::invalid_argument);
+}
+
 TEST(Account, constructor_defaultValues)
 {
     std::string const bech32Addr = "erd1spyavw0956vq68xj8y4tenjpq2wd5a9p2c6j8gsz7ztyrnpxrruqzu66jx";
@@ -5,6 +5,10 @@
 #include "utils/errors.h"
 #include "filehandler/pemreader.h"
 #include "filehandler/keyfilereader.h"
+#include "filehandler/keyfileloader.h"
+#include "filehandler/pembundle.h"
+
+#include <fstream>
 
 class PemFileReaderConstructorFixture : public ::testing::Test
 {
@@ -164,3 +168,142 @@ TEST(KeyFileReader, getAddress_getSeed_differentFiles)
     EXPECT_EQ(bobKeyFile.getSeed(), bobPem.getSeed());
     EXPECT_EQ(carolKeyFile.getSeed(), carolPem.getSeed());
 }
+
+TEST(KeyFileLoader, load_parallel)
+{
+    std::vector<KeyFileCredentials> const files = {
+            {getCanonicalTestDataPath("aliceKeyFile.json"), "password"},
+            {getCanonicalTestDataPath("keyFileInvalidMac.json"), "password"},
+            {getCanonicalTestDataPath("bobKeyFile.json"), "password"},
+            {getCanonicalTestDataPath("missingKeyFile.json"), "password"},
+            {getCanonicalTestDataPath("carolKeyFile.json"), "password"}};
+
+    std::vector<KeyFileLoadResult> const results = KeyFileLoader(4).load(files);
+
+    ASSERT_EQ(results.size(), files.size());
+    EXPECT_EQ(results[0].keyFile->getAddress().getBech32Address(), "erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th");
+    EXPECT_EQ(results[1].keyFile, nullptr);
+    EXPECT_EQ(results[1].error, ERROR_MSG_MAC);
+    EXPECT_EQ(results[2].keyFile->getAddress().getBech32Address(), "erd1spyavw0956vq68xj8y4tenjpq2wd5a9p2c6j8gsz7ztyrnpxrruqzu66jx");
+    EXPECT_EQ(results[3].keyFile, nullptr);
+    EXPECT_EQ(results[3].error, ERROR_MSG_FILE_DOES_NOT_EXIST + files[3].filePath);
+    EXPECT_EQ(results[4].keyFile->getSeed(), PemFileReader(getCanonicalTestDataPath("carolPem.pem")).getSeed());
+}
+
+TEST(KeyFileCache, unlockedOncePerFileAndPassword)
+{
+    auto const cache = std::make_shared<KeyFileCache>();
+    KeyFileLoader const loader(2, cache);
+    std::vector<KeyFileCredentials> const files = {
+            {getCanonicalTestDataPath("aliceKeyFile.json"), "password"},
+            {getCanonicalTestDataPath("bobKeyFile.json"), "password"}};
+
+    std::vector<KeyFileLoadResult> const first = loader.load(files);
+    EXPECT_EQ(cache->size(), 2U);
+
+    std::vector<KeyFileLoadResult> const second = loader.load(files);
+    EXPECT_EQ(second[0].keyFile->getSeed(), first[0].keyFile->getSeed());
+    EXPECT_EQ(second[1].keyFile->getSeed(), first[1].keyFile->getSeed());
+
+    // A cached file still needs its password
+    EXPECT_THROW(KeyFileReader(files[0].filePath, "wrong password", *cache), std::runtime_error);
+    EXPECT_EQ(KeyFileReader(files[0].filePath, "password", *cache).getSeed(), first[0].keyFile->getSeed());
+
+    cache->clear();
+    EXPECT_EQ(cache->size(), 0U);
+}
+
+TEST(KeyFileCache, modifiedFileIsUnlockedAgain)
+{
+    std::string const filePath = ::testing::TempDir() + "keyFileCacheTest.json";
+    auto const copy = [&filePath](std::string const &source)
+    {
+        std::ifstream in(getCanonicalTestDataPath(source));
+        std::ofstream out(filePath, std::ios::trunc);
+        out << in.rdbuf();
+    };
+
+    KeyFileCache cache;
+    copy("aliceKeyFile.json");
+    EXPECT_EQ(KeyFileReader(filePath, "password", cache).getAddress().getBech32Address(),
+              "erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th");
+
+    copy("bobKeyFile.json");
+    EXPECT_EQ(KeyFileReader(filePath, "password", cache).getAddress().getBech32Address(),
+              "erd1spyavw0956vq68xj8y4tenjpq2wd5a9p2c6j8gsz7ztyrnpxrruqzu66jx");
+    EXPECT_EQ(cache.size(), 1U);
+
+    std::remove(filePath.c_str());
+}
+
+TEST(PemBundle, allBlocks_sameAsPemFileReader)
+{
+    std::vector<std::string> const singleKeyFiles = {"alicePem.pem", "bobPem.pem", "carolPem.pem", "keysValid1.pem", "alicePem.pem"};
+
+    PemBundle const bundle(getCanonicalTestDataPath("keysBundle.pem"), 2);
+
+    ASSERT_EQ(bundle.size(), singleKeyFiles.size());
+    for (std::size_t i = 0; i < bundle.size(); ++i)
+    {
+        PemFileReader const pem(getCanonicalTestDataPath(singleKeyFiles[i]));
+        EXPECT_EQ(bundle.getSeed(i), pem.getSeed());
+        EXPECT_EQ(bundle.getAddress(i), pem.getAddress());
+        EXPECT_EQ(bundle.getPublicKey(i), pem.getAddress().getPublicKey());
+    }
+}
+
+TEST(PemBundle, find)
+{
+    PemBundle const bundle(getCanonicalTestDataPath("keysBundle.pem"));
+
+    // Alice is in the bundle twice, the first one is found
+    EXPECT_EQ(bundle.find(Address("erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th")), 0U);
+    EXPECT_EQ(bundle.find(Address("erd1k2s324ww2g0yj38qn2ch2jwctdy8mnfxep94q9arncc6xecg3xaq6mjse8")), 2U);
+    EXPECT_EQ(bundle.find(Address("erd1sjsk3n2d0krq3pyxxtgf0q7j3t56sgusqaujj4n82l39t9h7jers6gslr4")), 3U);
+    EXPECT_EQ(bundle.find(Address(Address::PublicKey{})), PemBundle::npos);
+}
+
+TEST(PemBundle, invalidFiles)
+{
+    EXPECT_THROW(PemBundle(getCanonicalTestDataPath("keysBundleInvalid.pem")), std::length_error);
+    EXPECT_THROW(PemBundle(getCanonicalTestDataPath("keysNotEnoughBytes.pem")), std::invalid_argument);
+    EXPECT_THROW(PemBundle(getCanonicalTestDataPath("keysEmptyFile.pem")), std::invalid_argument);
+    EXPECT_THROW(PemBundle(getCanonicalTestDataPath("keysInvalidExtension.pme")), std::invalid_argument);
+}
+
+TEST(PemBundle, invalidBlock_reportsItsIndex)
+{
+    // The second of three blocks is invalid, whichever thread decodes it
+    for (unsigned int numThreads = 1; numThreads <= 3; ++numThreads)
+    {
+        try
+        {
+            PemBundle(getCanonicalTestDataPath("keysBundleInvalid.pem"), numThreads);
+            FAIL();
+        }
+        catch (std::length_error const &e)
+        {
+            EXPECT_EQ(std::string(e.what()).find(ERROR_MSG_PEM_BLOCK + "1."), 0U);
+        }
+    }
+}
+
+TEST(PemBundle, windowsLineEndings)
+{
+    std::string const filePath = ::testing::TempDir() + "pemBundleTest.pem";
+    {
+        std::ifstream in(getCanonicalTestDataPath("keysBundle.pem"));
+        std::ofstream out(filePath, std::ios::trunc);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            out << line << "\r\n";
+        }
+    }
+
+    PemBundle const bundle(filePath);
+    EXPECT_EQ(bundle.size(), 5U);
+    EXPECT_EQ(bundle.getSeed(1), PemFileReader(getCanonicalTestDataPath("bobPem.pem")).getSeed());
+
+    std::remove(filePath.c_str());
+}
@@ -0,0 +1,72 @@
+#include "gtest/gtest.h"
+
+#include "internal/biguint.h"
+#include "bigint/integer.h"
+
+#include <random>
+
+namespace
+{
+// integer::str() is very slow for large values, so results are parsed back and compared as integers instead
+bool sameValue(BigUInt const &value, integer const &expected)
+{
+    return integer(value.getValue(), 10) == expected && integer(value.getHexValue(), 16) == expected;
+}
+}
+
+// Compares every operation against the external arbitrary precision integer, which BigUInt used to be built on
+TEST(BigUInt, sameAsReferenceInteger)
+{
+    std::mt19937_64 rng(42);
+
+    auto const randomDecimal = [&rng]()
+    {
+        // Covers values from a single limb up to heap allocated ones (more than 256 bits)
+        std::size_t const numDigits = 1 + rng() % 90;
+        std::string value;
+        for (std::size_t i = 0; i < numDigits; ++i)
+        {
+            bool const useNine = (rng() % 4) == 0;
+            value.push_back(char('0' + (useNine ? 9 : rng() % 10)));
+        }
+        return value;
+    };
+
+    for (int i = 0; i < 60; ++i)
+    {
+        std::string const a = randomDecimal();
+        std::string const b = (i % 10 == 0) ? a : randomDecimal();
+
+        integer const ia(a, 10);
+        integer const ib(b, 10);
+        BigUInt const ba(a);
+        BigUInt const bb(b);
+
+        ASSERT_TRUE(sameValue(ba, ia)) << a;
+        ASSERT_TRUE(sameValue(ba + bb, ia + ib)) << a << " + " << b;
+        ASSERT_TRUE(sameValue(ba * bb, ia * ib)) << a << " * " << b;
+        ASSERT_EQ(ba == bb, ia == ib);
+        ASSERT_EQ(ba < bb, ia < ib);
+        ASSERT_EQ(ba > bb, ia > ib);
+
+        if (!(ia < ib))
+        {
+            ASSERT_TRUE(sameValue(ba - bb, ia - ib)) << a << " - " << b;
+        }
+
+        if (ib != integer(0))
+        {
+            auto const expected = ia.divmod(ia, ib);
+            auto const result = ba.divmod(bb);
+            ASSERT_TRUE(sameValue(result.first, expected.first)) << a << " / " << b;
+            ASSERT_TRUE(sameValue(result.second, expected.second)) << a << " % " << b;
+
+            // Products divided back exercise multi limb divisors with large quotients
+            integer const iProduct = ia * ib + integer(7);
+            auto const expectedProduct = iProduct.divmod(iProduct, ib);
+            auto const resultProduct = (ba * bb + BigUInt(7)).divmod(bb);
+            ASSERT_TRUE(sameValue(resultProduct.first, expectedProduct.first)) << a << " * " << b << " + 7";
+            ASSERT_TRUE(sameValue(resultProduct.second, expectedProduct.second)) << a << " * " << b << " + 7";
+        }
+    }
+}
@@ -1,6 +1,10 @@
 #include "gtest/gtest.h"
 
 #include "internal/biguint.h"
+#include "internal/optional.h"
+
+#include <random>
+#include <vector>
 
 struct bigUIntData
 {
@@ -135,3 +139,173 @@ TEST(BigUInt, add_substract)
     EXPECT_EQ(v1.getValue(), "145"); // v1's internal value has not change
     EXPECT_EQ(v2.getValue(), "12"); // v2's internal value has not change
 }
+
+TEST(BigUInt, normalizedValues)
+{
+    EXPECT_EQ(BigUInt("").getValue(), "0");
+    EXPECT_EQ(BigUInt("0").getHexValue(), "00");
+    EXPECT_EQ(BigUInt("000123").getValue(), "123");
+    EXPECT_TRUE(BigUInt("000123") == BigUInt(123));
+    EXPECT_EQ(BigUInt(UINT64_MAX).getValue(), "18446744073709551615");
+    EXPECT_EQ(BigUInt("18446744073709551616").getHexValue(), "010000000000000000");
+    EXPECT_THROW(BigUInt("-"), std::invalid_argument);
+    EXPECT_THROW(BigUInt(" 1"), std::invalid_argument);
+    EXPECT_THROW(BigUInt(1) / BigUInt(0), std::invalid_argument);
+    EXPECT_THROW(BigUInt(1) - BigUInt(2), std::invalid_argument);
+}
+
+TEST(BigUInt, compoundAssignment)
+{
+    BigUInt const limbMax(UINT64_MAX);
+
+    BigUInt v(145);
+    v += BigUInt(12);
+    EXPECT_EQ(v.getValue(), "157");
+    v -= BigUInt(57);
+    EXPECT_EQ(v.getValue(), "100");
+    v *= BigUInt(1000000000000000000);
+    EXPECT_EQ(v.getValue(), "100000000000000000000");
+    v /= BigUInt(7);
+    EXPECT_EQ(v.getValue(), "14285714285714285714");
+    v /= BigUInt("1000000000000000000000");
+    EXPECT_EQ(v.getValue(), "0");
+
+    // Carries across limbs, up to heap storage and back
+    BigUInt big(limbMax);
+    for (int i = 0; i < 5; ++i)
+    {
+        big *= limbMax;
+    }
+    BigUInt const expected = big + BigUInt(1);
+    big += BigUInt(1);
+    EXPECT_TRUE(big == expected);
+    big -= expected;
+    EXPECT_EQ(big.getValue(), "0");
+
+    BigUInt small(3);
+    EXPECT_THROW(small -= BigUInt(4), std::invalid_argument);
+    EXPECT_EQ(small.getValue(), "3"); // unchanged
+    EXPECT_THROW(small /= BigUInt(0), std::invalid_argument);
+}
+
+TEST(BigUInt, compoundAssignment_self)
+{
+    BigUInt v(UINT64_MAX);
+    v += v;
+    EXPECT_EQ(v.getValue(), "36893488147419103230");
+    v *= v;
+    EXPECT_EQ(v.getValue(), "1361129467683753853705924477137396432900");
+    v /= v;
+    EXPECT_EQ(v.getValue(), "1");
+    v -= v;
+    EXPECT_EQ(v.getValue(), "0");
+}
+
+TEST(BigUInt, moved_fromHeapSizedValue)
+{
+    std::string const large = "123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890";
+
+    BigUInt a(large);
+    BigUInt const b(std::move(a));
+    EXPECT_EQ(b.getValue(), large);
+    EXPECT_EQ(a.getValue(), "0");
+    a += BigUInt(large);
+    EXPECT_EQ(a, b);
+
+    BigUInt c(1);
+    c = std::move(a);
+    EXPECT_EQ(c.getValue(), large);
+    EXPECT_EQ(a.getValue(), "0");
+    a = BigUInt(large) * BigUInt(large);
+    EXPECT_EQ(a / c, b);
+}
+
+TEST(BigUInt, sum)
+{
+    std::vector<BigUInt> const values = {BigUInt("18446744073709551615"), BigUInt(1), BigUInt("1000000000000000000")};
+    EXPECT_EQ(BigUInt::sum(values.begin(), values.end()).getValue(), "19446744073709551616");
+    EXPECT_EQ(BigUInt::sum(values.begin(), values.begin()).getValue(), "0");
+
+    std::vector<std::pair<std::string, BigUInt>> const balances = {{"a", BigUInt(10)}, {"b", BigUInt(20)}, {"c", BigUInt(30)}};
+    auto const balance = [](std::pair<std::string, BigUInt> const &entry) -> BigUInt const & { return entry.second; };
+    EXPECT_EQ(BigUInt::sum(balances.begin(), balances.end(), balance).getValue(), "60");
+
+    BigUInt total(40);
+    total.accumulate(balances.begin(), balances.end(), balance);
+    EXPECT_EQ(total.getValue(), "100");
+}
+
+// Division identities on limb patterns which trigger the rare correction steps of long division
+TEST(BigUInt, divmod_limbPatterns)
+{
+    std::mt19937_64 rng(42);
+    BigUInt const limbBase("18446744073709551616");
+    uint64_t const patterns[] = {0, 1, UINT64_MAX, UINT64_MAX - 1, 1ULL << 63, (1ULL << 63) - 1, 0xFFFFFFFF00000000ULL};
+
+    auto const randomValue = [&](std::size_t numLimbs)
+    {
+        BigUInt value(0);
+        for (std::size_t i = 0; i < numLimbs; ++i)
+        {
+            uint64_t const limb = (rng() % 2) ? patterns[rng() % 7] : rng();
+            value = value * limbBase + BigUInt(limb);
+        }
+        return value;
+    };
+
+    for (int i = 0; i < 3000; ++i)
+    {
+        BigUInt const a = randomValue(1 + rng() % 8);
+        BigUInt const b = randomValue(1 + rng() % 6);
+        if (b == BigUInt(0))
+        {
+            continue;
+        }
+
+        std::pair<BigUInt, BigUInt> const result = a.divmod(b);
+        ASSERT_TRUE(result.second < b) << a.getValue() << " % " << b.getValue();
+        ASSERT_TRUE(result.first * b + result.second == a) << a.getValue() << " / " << b.getValue();
+        ASSERT_TRUE((a + b) - b == a);
+        ASSERT_TRUE(BigUInt(a.getValue()) == a);
+    }
+}
+
+TEST(Optional, emptyAndSet)
+{
+    Optional<std::string> value;
+    EXPECT_EQ(value, nullptr);
+    EXPECT_FALSE(value.hasValue());
+
+    value = "abc";
+    EXPECT_NE(value, nullptr);
+    EXPECT_EQ(*value, "abc");
+    EXPECT_EQ(value->size(), 3U);
+
+    value = nullptr;
+    EXPECT_EQ(value, nullptr);
+
+    value = std::make_shared<std::string>("def");
+    EXPECT_EQ(*value, "def");
+    value = std::shared_ptr<std::string>();
+    EXPECT_EQ(value, nullptr);
+}
+
+TEST(Optional, valueSemantics)
+{
+    Optional<std::vector<int>> a(std::vector<int>{1, 2, 3});
+    Optional<std::vector<int>> b = a;
+    b->push_back(4);
+    EXPECT_EQ(a->size(), 3U);
+    EXPECT_NE(a, b);
+
+    // Assigning onto a set value reuses its storage
+    int const *const data = b->data();
+    b = a;
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(b->data(), data);
+
+    Optional<std::vector<int>> c(std::move(a));
+    EXPECT_EQ(c, b);
+    EXPECT_EQ(Optional<std::vector<int>>(), Optional<std::vector<int>>(nullptr));
+    EXPECT_NE(c, Optional<std::vector<int>>());
+}
@@ -0,0 +1,139 @@
+#include "gtest/gtest.h"
+
+#include "provider/async_proxyprovider.h"
+#include "mock_proxy.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+std::string const ADDRESS = "erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th";
+
+void reply(httplib::Response &res, std::string const &data)
+{
+    res.set_content(MockProxy::successResponse(data), "application/json");
+}
+
+class AsyncProxyProviderFixture : public ::testing::Test
+{
+public:
+    AsyncProxyProviderFixture() :
+            m_inFlight(0),
+            m_maxInFlight(0)
+    {
+        httplib::Server &server = m_mock.server();
+        server.Get("/network/config", [](httplib::Request const &, httplib::Response &res)
+        {
+            reply(res, R"({"config":{"erd_chain_id":"T","erd_gas_per_data_byte":1500,"erd_min_gas_limit":50000,"erd_min_gas_price":1000000000}})");
+        });
+        server.Get("/address/" + ADDRESS, [](httplib::Request const &, httplib::Response &res)
+        {
+            reply(res, R"({"account":{"balance":"1000","nonce":7}})");
+        });
+        server.Get("/address/" + ADDRESS + "/esdt/TOKEN-abcdef", [](httplib::Request const &, httplib::Response &res)
+        {
+            reply(res, R"({"tokenData":{"balance":"123456789012345678901234567890"}})");
+        });
+        server.Post("/transaction/send", [](httplib::Request const &, httplib::Response &res)
+        {
+            reply(res, R"({"txHash":"abcd"})");
+        });
+        server.Get(R"(/transaction/(\w+)/status)", [this](httplib::Request const &req, httplib::Response &res)
+        {
+            int const current = ++m_inFlight;
+            int previousMax = m_maxInFlight;
+            while (current > previousMax && !m_maxInFlight.compare_exchange_weak(previousMax, current))
+            {}
+            --m_inFlight;
+
+            if (req.matches[1] == "unknown")
+            {
+                res.set_content(R"({"data":null,"error":"transaction not found","code":"internal_issue"})", "application/json");
+            }
+            else
+            {
+                reply(res, R"({"status":"success"})");
+            }
+        });
+    }
+
+    MockProxy m_mock;
+    std::atomic<int> m_inFlight;
+    std::atomic<int> m_maxInFlight;
+};
+}
+
+TEST_F(AsyncProxyProviderFixture, futures)
+{
+    AsyncProxyProvider proxy(m_mock.url());
+    Address const address(ADDRESS);
+
+    std::future<NetworkConfig> networkConfig = proxy.getNetworkConfig();
+    std::future<Account> account = proxy.getAccount(address);
+    std::future<BigUInt> balance = proxy.getESDTBalance(address, "TOKEN-abcdef");
+    std::future<TransactionStatus> status = proxy.getTransactionStatus("abcd");
+
+    Transaction tx;
+    tx.m_sender = std::make_shared<Address>(address);
+    tx.m_receiver = std::make_shared<Address>(address);
+    std::future<std::string> txHash = proxy.send(tx);
+
+    EXPECT_EQ(networkConfig.get().chainId, "T");
+    EXPECT_EQ(account.get().getNonce(), 7U);
+    EXPECT_EQ(balance.get(), BigUInt("123456789012345678901234567890"));
+    EXPECT_TRUE(status.get().isSuccessful());
+    EXPECT_EQ(txHash.get(), "abcd");
+}
+
+TEST_F(AsyncProxyProviderFixture, errors)
+{
+    AsyncProxyProvider proxy(m_mock.url());
+
+    std::future<TransactionStatus> status = proxy.getTransactionStatus("unknown");
+    EXPECT_THROW(status.get(), std::runtime_error);
+
+    std::promise<std::exception_ptr> error;
+    proxy.getTransactionStatus("unknown",
+                               [](TransactionStatus) { FAIL(); },
+                               [&error](std::exception_ptr e) { error.set_value(e); });
+    EXPECT_THROW(std::rethrow_exception(error.get_future().get()), std::runtime_error);
+}
+
+TEST_F(AsyncProxyProviderFixture, callbacks_manyInFlight)
+{
+    ProxyProviderConfig config;
+    config.maxConnections = 4;
+
+    std::atomic<int> numSuccessful(0);
+    std::atomic<int> numChained(0);
+    {
+        AsyncProxyProvider proxy(m_mock.url(), config, 64);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            proxy.getTransactionStatus("hash" + std::to_string(i),
+                                       [&](TransactionStatus status)
+                                       {
+                                           int const count = status.isSuccessful() ? ++numSuccessful : 0;
+
+                                           // Requests issued from a callback must not block on a full queue
+                                           if (count % 100 == 0 && count > 0)
+                                           {
+                                               proxy.getNetworkConfig([&](NetworkConfig) { ++numChained; }, nullptr);
+                                           }
+                                       },
+                                       [](std::exception_ptr) { FAIL(); });
+            EXPECT_LE(proxy.numInFlight(), 64U);
+        }
+        // Destructor waits for everything in flight
+    }
+
+    EXPECT_EQ(numSuccessful, 1000);
+    EXPECT_EQ(numChained, 10);
+    EXPECT_LE(m_maxInFlight, 4);
+    EXPECT_LE(m_mock.numConnections(), 4U);
+}
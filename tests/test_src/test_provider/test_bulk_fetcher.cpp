@@ -0,0 +1,243 @@
+#include "gtest/gtest.h"
+
+#include "provider/bulk_fetcher.h"
+#include "mock_proxy.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace
+{
+std::vector<Address> createAddresses(std::size_t const count)
+{
+    std::vector<Address> addresses;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Address::PublicKey publicKey{};
+        publicKey[0] = uint8_t(i & 0xFF);
+        publicKey[1] = uint8_t(i >> 8);
+        addresses.emplace_back(publicKey);
+    }
+    return addresses;
+}
+
+// Account nonce of the i-th address of createAddresses()
+uint64_t nonceOf(std::string const &bech32)
+{
+    Address const address(bech32);
+    return address.getPublicKey()[0] + 256U * address.getPublicKey()[1];
+}
+
+class BulkProxyFetcherFixture : public ::testing::Test
+{
+public:
+    BulkProxyFetcherFixture() :
+            m_latency(0),
+            m_failuresPerAddress(0),
+            m_rejectAll(false),
+            m_inFlight(0),
+            m_maxInFlight(0)
+    {
+        m_mock.server().Get(R"(/address/(\w+))", [this](httplib::Request const &req, httplib::Response &res)
+        {
+            std::string const bech32 = req.matches[1];
+            if (!beginRequest(bech32, res)) return;
+
+            res.set_content(MockProxy::successResponse(R"({"account":{"balance":"1000","nonce":)" + std::to_string(nonceOf(bech32)) + "}}"),
+                            "application/json");
+        });
+        m_mock.server().Get(R"(/address/(\w+)/esdt)", [this](httplib::Request const &req, httplib::Response &res)
+        {
+            std::string const bech32 = req.matches[1];
+            if (!beginRequest(bech32, res)) return;
+
+            res.set_content(MockProxy::successResponse(R"({"esdts":{"TKN-abcdef":{"balance":")" + std::to_string(nonceOf(bech32)) + R"("}}})"),
+                            "application/json");
+        });
+    }
+
+protected:
+    // Injects latency, and failures: the first m_failuresPerAddress responses of each address are 503, or all
+    // responses are proxy errors if m_rejectAll. Returns false for a failure.
+    bool beginRequest(std::string const &bech32, httplib::Response &res)
+    {
+        int const current = ++m_inFlight;
+        int previousMax = m_maxInFlight;
+        while (current > previousMax && !m_maxInFlight.compare_exchange_weak(previousMax, current))
+        {}
+        std::this_thread::sleep_for(m_latency);
+        --m_inFlight;
+
+        if (m_rejectAll)
+        {
+            res.status = 400;
+            res.set_content(R"({"data":null,"error":"invalid address","code":"bad_request"})", "application/json");
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_numFailures[bech32] < m_failuresPerAddress)
+        {
+            ++m_numFailures[bech32];
+            res.status = 503;
+            res.set_content("Service Unavailable", "text/plain");
+            return false;
+        }
+        return true;
+    }
+
+    BulkFetchConfig fastRetries() const
+    {
+        BulkFetchConfig config;
+        config.maxConcurrency = 8;
+        config.initialBackoff = std::chrono::milliseconds(1);
+        config.maxBackoff = std::chrono::milliseconds(4);
+        return config;
+    }
+
+    MockProxy m_mock;
+    std::chrono::milliseconds m_latency;
+    int m_failuresPerAddress;
+    bool m_rejectAll;
+    std::atomic<int> m_inFlight;
+    std::atomic<int> m_maxInFlight;
+    std::mutex m_mutex;
+    std::map<std::string, int> m_numFailures;
+};
+}
+
+TEST_F(BulkProxyFetcherFixture, getAccounts_boundedConcurrency)
+{
+    m_latency = std::chrono::milliseconds(20);
+    std::vector<Address> const addresses = createAddresses(200);
+
+    BulkProxyFetcher fetcher(m_mock.url(), ProxyProviderConfig(), fastRetries());
+
+    std::mutex mutex;
+    std::set<std::size_t> indexes;
+    auto const start = std::chrono::steady_clock::now();
+    fetcher.getAccounts(addresses,
+                        [&](std::size_t const index, Account const &account)
+                        {
+                            EXPECT_EQ(account.getAddress(), addresses[index]);
+                            EXPECT_EQ(account.getNonce(), index);
+                            std::lock_guard<std::mutex> lock(mutex);
+                            indexes.insert(index);
+                        },
+                        [](std::size_t, std::exception_ptr) { FAIL(); });
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(indexes.size(), addresses.size());
+    EXPECT_GT(m_maxInFlight, 1);
+    EXPECT_LE(m_maxInFlight, 8);
+    EXPECT_LE(m_mock.numConnections(), 8U);
+    // 200 sequential requests would take 4s
+    EXPECT_LT(elapsed, std::chrono::milliseconds(200 * 20 / 2));
+    EXPECT_EQ(fetcher.numRetries(), 0U);
+}
+
+TEST_F(BulkProxyFetcherFixture, getAllESDTBalances)
+{
+    std::vector<Address> const addresses = createAddresses(50);
+
+    BulkProxyFetcher fetcher(m_mock.url(), ProxyProviderConfig(), fastRetries());
+
+    std::atomic<std::size_t> numResults(0);
+    fetcher.getAllESDTBalances(addresses,
+                               [&](std::size_t const index, std::map<std::string, BigUInt> const &balances)
+                               {
+                                   EXPECT_EQ(balances.at("TKN-abcdef"), BigUInt(std::to_string(index)));
+                                   ++numResults;
+                               },
+                               [](std::size_t, std::exception_ptr) { FAIL(); });
+
+    EXPECT_EQ(numResults, 50U);
+}
+
+TEST_F(BulkProxyFetcherFixture, retriesTransientFailures)
+{
+    m_failuresPerAddress = 2;
+    std::vector<Address> const addresses = createAddresses(20);
+
+    BulkProxyFetcher fetcher(m_mock.url(), ProxyProviderConfig(), fastRetries());
+
+    std::atomic<std::size_t> numResults(0);
+    fetcher.getAccounts(addresses,
+                        [&](std::size_t, Account const &) { ++numResults; },
+                        [](std::size_t, std::exception_ptr) { FAIL(); });
+
+    EXPECT_EQ(numResults, 20U);
+    EXPECT_EQ(fetcher.numRetries(), 40U);
+    EXPECT_EQ(m_mock.numRequests(), 60U);
+}
+
+TEST_F(BulkProxyFetcherFixture, errorsAfterRetries)
+{
+    m_failuresPerAddress = 10;
+    std::vector<Address> const addresses = createAddresses(5);
+
+    BulkFetchConfig config = fastRetries();
+    config.maxRetries = 2;
+    BulkProxyFetcher fetcher(m_mock.url(), ProxyProviderConfig(), config);
+
+    std::atomic<std::size_t> numErrors(0);
+    fetcher.getAccounts(addresses,
+                        [](std::size_t, Account const &) { FAIL(); },
+                        [&](std::size_t, std::exception_ptr const error)
+                        {
+                            EXPECT_THROW(std::rethrow_exception(error), std::invalid_argument);
+                            ++numErrors;
+                        });
+
+    EXPECT_EQ(numErrors, 5U);
+    EXPECT_EQ(m_mock.numRequests(), 15U);
+}
+
+TEST_F(BulkProxyFetcherFixture, noRetryOfProxyErrors)
+{
+    m_rejectAll = true;
+    std::vector<Address> const addresses = createAddresses(3);
+
+    BulkProxyFetcher fetcher(m_mock.url(), ProxyProviderConfig(), fastRetries());
+
+    std::atomic<std::size_t> numErrors(0);
+    fetcher.getAllESDTBalances(addresses,
+                               [](std::size_t, std::map<std::string, BigUInt> const &) { FAIL(); },
+                               [&](std::size_t, std::exception_ptr const error)
+                               {
+                                   EXPECT_THROW(std::rethrow_exception(error), std::runtime_error);
+                                   ++numErrors;
+                               });
+
+    EXPECT_EQ(numErrors, 3U);
+    EXPECT_EQ(fetcher.numRetries(), 0U);
+}
+
+TEST_F(BulkProxyFetcherFixture, rateLimit)
+{
+    std::vector<Address> const addresses = createAddresses(11);
+
+    BulkFetchConfig config = fastRetries();
+    config.maxRequestsPerSecond = 50;
+    config.burst = 1;
+    BulkProxyFetcher fetcher(m_mock.url(), ProxyProviderConfig(), config);
+
+    auto const start = std::chrono::steady_clock::now();
+    fetcher.getAccounts(addresses, nullptr, [](std::size_t, std::exception_ptr) { FAIL(); });
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+
+    // The first request starts at once, the other 10 one every 20ms
+    EXPECT_GE(elapsed, std::chrono::milliseconds(190));
+    EXPECT_EQ(m_mock.numRequests(), 11U);
+}
+
+TEST_F(BulkProxyFetcherFixture, noAddresses)
+{
+    BulkProxyFetcher fetcher(m_mock.url());
+
+    fetcher.getAccounts({}, [](std::size_t, Account const &) { FAIL(); }, [](std::size_t, std::exception_ptr) { FAIL(); });
+}
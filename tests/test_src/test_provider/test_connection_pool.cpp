@@ -0,0 +1,146 @@
+#include "gtest/gtest.h"
+
+#include "provider/proxyprovider.h"
+#include "mock_proxy.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+std::string const NETWORK_CONFIG =
+        R"({"config":{"erd_chain_id":"T","erd_gas_per_data_byte":1500,"erd_min_gas_limit":50000,"erd_min_gas_price":1000000000}})";
+
+std::string const ACCOUNT =
+        R"({"account":{"address":"erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th","balance":"1000","nonce":7}})";
+
+void serveNetworkConfig(MockProxy &proxy)
+{
+    proxy.server().Get("/network/config", [](httplib::Request const &, httplib::Response &res)
+    {
+        res.set_content(MockProxy::successResponse(NETWORK_CONFIG), "application/json");
+    });
+}
+}
+
+TEST(ProxyProvider, reusesConnection_sequentialRequests)
+{
+    MockProxy mock;
+    serveNetworkConfig(mock);
+    ProxyProvider const proxy(mock.url());
+
+    for (int i = 0; i < 50; ++i)
+    {
+        EXPECT_EQ(proxy.getNetworkConfig().chainId, "T");
+    }
+
+    EXPECT_EQ(mock.numRequests(), 50U);
+    EXPECT_EQ(mock.numConnections(), 1U);
+}
+
+TEST(ProxyProvider, boundsConnections_concurrentRequests)
+{
+    MockProxy mock;
+    std::atomic<int> inFlight(0);
+    std::atomic<int> maxInFlight(0);
+    mock.server().Get(R"(/address/(erd1\w+))", [&](httplib::Request const &, httplib::Response &res)
+    {
+        int const current = ++inFlight;
+        int previousMax = maxInFlight;
+        while (current > previousMax && !maxInFlight.compare_exchange_weak(previousMax, current))
+        {}
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        --inFlight;
+        res.set_content(MockProxy::successResponse(ACCOUNT), "application/json");
+    });
+
+    ProxyProviderConfig config;
+    config.maxConnections = 3;
+    ProxyProvider proxy(mock.url(), config);
+    Address const address("erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th");
+
+    std::atomic<int> numSucceeded(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t)
+    {
+        threads.emplace_back([&]()
+                             {
+                                 for (int i = 0; i < 20; ++i)
+                                 {
+                                     if (proxy.getAccount(address).getNonce() == 7)
+                                     {
+                                         ++numSucceeded;
+                                     }
+                                 }
+                             });
+    }
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(numSucceeded, 160);
+    EXPECT_EQ(mock.numRequests(), 160U);
+    EXPECT_LE(mock.numConnections(), 3U);
+    EXPECT_LE(maxInFlight, 3);
+}
+
+TEST(ProxyProvider, dropsIdleConnections)
+{
+    MockProxy mock;
+    serveNetworkConfig(mock);
+
+    ProxyProviderConfig config;
+    config.idleTimeout = std::chrono::milliseconds(20);
+    ProxyProvider const proxy(mock.url(), config);
+
+    proxy.getNetworkConfig();
+    proxy.getNetworkConfig();
+    EXPECT_EQ(mock.numConnections(), 1U);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    proxy.getNetworkConfig();
+    EXPECT_EQ(mock.numConnections(), 2U);
+}
+
+TEST(ProxyProvider, readTimeout)
+{
+    MockProxy mock;
+    mock.server().Get("/network/config", [](httplib::Request const &, httplib::Response &res)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        res.set_content(MockProxy::successResponse(NETWORK_CONFIG), "application/json");
+    });
+
+    ProxyProviderConfig config;
+    config.readTimeout = std::chrono::milliseconds(50);
+    ProxyProvider const proxy(mock.url(), config);
+
+    EXPECT_THROW(proxy.getNetworkConfig(), std::runtime_error);
+}
+
+TEST(ProxyProvider, failover)
+{
+    MockProxy primary;
+    primary.server().Get("/network/config", [](httplib::Request const &, httplib::Response &res)
+    {
+        res.status = 503;
+    });
+    MockProxy fallback;
+    serveNetworkConfig(fallback);
+
+    ProxyProviderConfig config;
+    config.resilience.fallbackUrls = {fallback.url()};
+    config.resilience.initialBackoff = std::chrono::milliseconds(1);
+    config.resilience.failureThreshold = 2;
+    ProxyProvider const proxy(primary.url(), config);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(proxy.getNetworkConfig().chainId, "T");
+    }
+    EXPECT_EQ(primary.numRequests(), 2U);
+    EXPECT_EQ(fallback.numRequests(), 5U);
+}
@@ -0,0 +1,170 @@
+#include "gtest/gtest.h"
+
+#include "provider/nonce_manager.h"
+#include "mock_proxy.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace
+{
+std::string const ADDRESS = "erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th";
+
+class NonceManagerFixture : public ::testing::Test
+{
+public:
+    NonceManagerFixture() :
+            m_nonce(7),
+            m_sender(ADDRESS)
+    {
+        m_mock.server().Get("/address/" + ADDRESS, [this](httplib::Request const &, httplib::Response &res)
+        {
+            res.set_content(MockProxy::successResponse(
+                    R"({"account":{"balance":"0","nonce":)" + std::to_string(m_nonce) + "}}"), "application/json");
+        });
+    }
+
+    MockProxy m_mock;
+    std::atomic<uint64_t> m_nonce;
+    Address const m_sender;
+};
+}
+
+TEST_F(NonceManagerFixture, acquire_fetchesAccountOnce)
+{
+    NonceManager nonces{ProxyProvider(m_mock.url())};
+
+    EXPECT_EQ(nonces.acquire(m_sender), 7U);
+    EXPECT_EQ(nonces.acquire(m_sender), 8U);
+    EXPECT_EQ(nonces.acquire(m_sender), 9U);
+    EXPECT_EQ(m_mock.numRequests(), 1U);
+    EXPECT_EQ(nonces.getOutstanding(m_sender), std::vector<uint64_t>({7, 8, 9}));
+}
+
+TEST_F(NonceManagerFixture, acquire_concurrent)
+{
+    NonceManager nonces{ProxyProvider(m_mock.url())};
+
+    std::size_t const numThreads = 8;
+    std::size_t const numPerThread = 1000;
+    std::vector<std::vector<uint64_t>> acquired(numThreads);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&, t]()
+                             {
+                                 for (std::size_t i = 0; i < numPerThread; ++i)
+                                 {
+                                     acquired[t].push_back(nonces.acquire(m_sender));
+                                 }
+                             });
+    }
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+
+    std::vector<uint64_t> all;
+    for (auto const &nonceList: acquired)
+    {
+        EXPECT_TRUE(std::is_sorted(nonceList.begin(), nonceList.end()));
+        all.insert(all.end(), nonceList.begin(), nonceList.end());
+    }
+    std::sort(all.begin(), all.end());
+
+    ASSERT_EQ(all.size(), numThreads * numPerThread);
+    for (std::size_t i = 0; i < all.size(); ++i)
+    {
+        EXPECT_EQ(all[i], 7 + i);
+    }
+}
+
+TEST_F(NonceManagerFixture, release_gapsFilledFirst)
+{
+    NonceManager nonces{ProxyProvider(m_mock.url())};
+
+    for (int i = 0; i < 5; ++i)
+    {
+        nonces.acquire(m_sender); // 7..11
+    }
+
+    // Releasing the latest nonce hands it out again without leaving a gap
+    nonces.release(m_sender, 11);
+    EXPECT_TRUE(nonces.getGaps(m_sender).empty());
+    EXPECT_EQ(nonces.acquire(m_sender), 11U);
+
+    nonces.release(m_sender, 9);
+    nonces.release(m_sender, 8);
+    EXPECT_EQ(nonces.getGaps(m_sender), std::vector<uint64_t>({8, 9}));
+    EXPECT_EQ(nonces.getOutstanding(m_sender), std::vector<uint64_t>({7, 10, 11}));
+
+    EXPECT_EQ(nonces.acquire(m_sender), 8U);
+    EXPECT_EQ(nonces.acquire(m_sender), 9U);
+    EXPECT_EQ(nonces.acquire(m_sender), 12U);
+    EXPECT_TRUE(nonces.getGaps(m_sender).empty());
+}
+
+TEST_F(NonceManagerFixture, confirm)
+{
+    NonceManager nonces{ProxyProvider(m_mock.url())};
+
+    for (int i = 0; i < 4; ++i)
+    {
+        nonces.acquire(m_sender); // 7..10
+    }
+
+    nonces.confirm(m_sender, 8);
+    nonces.confirm(m_sender, 7);
+    nonces.confirm(m_sender, 10);
+    EXPECT_EQ(nonces.getOutstanding(m_sender), std::vector<uint64_t>({9}));
+
+    // Confirmed nonces are never reported as gaps
+    nonces.release(m_sender, 8);
+    EXPECT_TRUE(nonces.getGaps(m_sender).empty());
+}
+
+TEST_F(NonceManagerFixture, resync)
+{
+    NonceManager nonces{ProxyProvider(m_mock.url())};
+
+    nonces.acquire(m_sender);
+    nonces.acquire(m_sender);
+    nonces.acquire(m_sender);
+    nonces.release(m_sender, 7);
+
+    m_nonce = 20;
+    EXPECT_EQ(nonces.resync(m_sender), 20U);
+    EXPECT_TRUE(nonces.getGaps(m_sender).empty());
+    EXPECT_TRUE(nonces.getOutstanding(m_sender).empty());
+    EXPECT_EQ(nonces.acquire(m_sender), 20U);
+
+    // Outcomes of nonces acquired before the resync are ignored
+    nonces.release(m_sender, 8);
+    EXPECT_TRUE(nonces.getGaps(m_sender).empty());
+}
+
+TEST_F(NonceManagerFixture, sender_handle)
+{
+    NonceManager nonces{ProxyProvider(m_mock.url())};
+
+    NonceManager::Sender &sender = nonces.sender(m_sender);
+    EXPECT_EQ(&nonces.sender(m_sender), &sender);
+    EXPECT_EQ(m_mock.numRequests(), 1U);
+
+    EXPECT_EQ(sender.acquire(), 7U);
+    EXPECT_EQ(nonces.acquire(m_sender), 8U);
+    EXPECT_EQ(sender.acquire(), 9U);
+
+    sender.release(8);
+    sender.confirm(7);
+    EXPECT_EQ(nonces.getGaps(m_sender), std::vector<uint64_t>({8}));
+    EXPECT_EQ(sender.getOutstanding(), std::vector<uint64_t>({9}));
+    EXPECT_EQ(sender.acquire(), 8U);
+
+    // A resync keeps the handle valid
+    m_nonce = 20;
+    nonces.resync(m_sender);
+    EXPECT_EQ(sender.acquire(), 20U);
+    EXPECT_EQ(m_mock.numRequests(), 2U);
+}
@@ -0,0 +1,163 @@
+#include "gtest/gtest.h"
+
+#include "provider/proxyprovider.h"
+#include "mock_proxy.h"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+std::string const ADDRESS = "erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th";
+
+class ProxyCacheFixture : public ::testing::Test
+{
+public:
+    ProxyCacheFixture() :
+            m_nonce(7)
+    {
+        httplib::Server &server = m_mock.server();
+        server.Get("/network/config", [](httplib::Request const &, httplib::Response &res)
+        {
+            res.set_content(MockProxy::successResponse(
+                    R"({"config":{"erd_chain_id":"T","erd_gas_per_data_byte":1500,"erd_min_gas_limit":50000,"erd_min_gas_price":1000000000}})"),
+                            "application/json");
+        });
+        server.Get("/address/" + ADDRESS, [this](httplib::Request const &, httplib::Response &res)
+        {
+            res.set_content(MockProxy::successResponse(
+                    R"({"account":{"balance":"1000","nonce":)" + std::to_string(m_nonce) + "}}"), "application/json");
+        });
+        server.Get("/address/" + ADDRESS + "/esdt/TOKEN-abcdef", [](httplib::Request const &, httplib::Response &res)
+        {
+            res.set_content(MockProxy::successResponse(R"({"tokenData":{"balance":"5"}})"), "application/json");
+        });
+        server.Post("/transaction/send", [](httplib::Request const &, httplib::Response &res)
+        {
+            res.set_content(MockProxy::successResponse(R"({"txHash":"abcd"})"), "application/json");
+        });
+    }
+
+    MockProxy m_mock;
+    std::atomic<uint64_t> m_nonce;
+};
+
+void expectStats(ProxyProviderCacheStats const &stats, uint64_t hits, uint64_t staleHits, uint64_t misses)
+{
+    EXPECT_EQ(stats.hits, hits);
+    EXPECT_EQ(stats.staleHits, staleHits);
+    EXPECT_EQ(stats.misses, misses);
+}
+}
+
+TEST_F(ProxyCacheFixture, disabledByDefault)
+{
+    ProxyProvider const proxy(m_mock.url());
+
+    for (int i = 0; i < 3; ++i)
+    {
+        proxy.getNetworkConfig();
+    }
+
+    EXPECT_EQ(m_mock.numRequests(), 3U);
+    expectStats(proxy.getCacheStats(), 0, 0, 0);
+}
+
+TEST_F(ProxyCacheFixture, networkConfig_hitsAndInvalidation)
+{
+    ProxyProviderConfig config;
+    config.cache.networkConfigTtl = std::chrono::hours(1);
+    ProxyProvider proxy(m_mock.url(), config);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(proxy.getNetworkConfig().chainId, "T");
+    }
+    EXPECT_EQ(m_mock.numRequests(), 1U);
+    expectStats(proxy.getCacheStats(), 4, 0, 1);
+
+    proxy.invalidateNetworkConfig();
+    proxy.getNetworkConfig();
+    EXPECT_EQ(m_mock.numRequests(), 2U);
+
+    // Accounts are not cached with a zero ttl
+    Address const address(ADDRESS);
+    proxy.getAccount(address);
+    proxy.getAccount(address);
+    EXPECT_EQ(m_mock.numRequests(), 4U);
+    expectStats(proxy.getCacheStats(), 4, 0, 2);
+}
+
+TEST_F(ProxyCacheFixture, account_expires)
+{
+    ProxyProviderConfig config;
+    config.cache.accountTtl = std::chrono::milliseconds(20);
+    ProxyProvider proxy(m_mock.url(), config);
+    Address const address(ADDRESS);
+
+    EXPECT_EQ(proxy.getAccount(address).getNonce(), 7U);
+    m_nonce = 8;
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+
+    EXPECT_EQ(proxy.getAccount(address).getNonce(), 8U);
+    expectStats(proxy.getCacheStats(), 0, 0, 2);
+}
+
+TEST_F(ProxyCacheFixture, account_staleWhileRevalidate)
+{
+    ProxyProviderConfig config;
+    config.cache.accountTtl = std::chrono::milliseconds(20);
+    config.cache.staleWhileRevalidate = std::chrono::hours(1);
+    ProxyProvider proxy(m_mock.url(), config);
+    Address const address(ADDRESS);
+
+    EXPECT_EQ(proxy.getAccount(address).getNonce(), 7U);
+    m_nonce = 8;
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+
+    // The stale value is returned right away and refreshed in the background, once
+    EXPECT_EQ(proxy.getAccount(address).getNonce(), 7U);
+    bool refreshed = false;
+    for (int i = 0; i < 200 && !refreshed; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        refreshed = proxy.getAccount(address).getNonce() == 8U;
+    }
+
+    EXPECT_TRUE(refreshed);
+    EXPECT_EQ(m_mock.numRequests(), 2U);
+    ProxyProviderCacheStats const stats = proxy.getCacheStats();
+    EXPECT_EQ(stats.hits, 1U);
+    EXPECT_GE(stats.staleHits, 1U);
+    EXPECT_EQ(stats.misses, 1U);
+}
+
+TEST_F(ProxyCacheFixture, invalidateAccount)
+{
+    ProxyProviderConfig config;
+    config.cache.accountTtl = std::chrono::hours(1);
+    config.cache.esdtBalanceTtl = std::chrono::hours(1);
+    ProxyProvider proxy(m_mock.url(), config);
+    Address const address(ADDRESS);
+
+    proxy.getAccount(address);
+    EXPECT_EQ(proxy.getESDTBalance(address, "TOKEN-abcdef"), BigUInt(5));
+    proxy.getAccount(address);
+    proxy.getESDTBalance(address, "TOKEN-abcdef");
+    EXPECT_EQ(m_mock.numRequests(), 2U);
+
+    proxy.invalidateAccount(address);
+    proxy.getAccount(address);
+    proxy.getESDTBalance(address, "TOKEN-abcdef");
+    EXPECT_EQ(m_mock.numRequests(), 4U);
+
+    // Sending a transaction changes the nonce and ESDT balances of its sender
+    Transaction tx;
+    tx.m_sender = std::make_shared<Address>(address);
+    tx.m_receiver = std::make_shared<Address>(address);
+    proxy.send(tx);
+    m_nonce = 8;
+    EXPECT_EQ(proxy.getAccount(address).getNonce(), 8U);
+    proxy.getESDTBalance(address, "TOKEN-abcdef");
+    EXPECT_EQ(m_mock.numRequests(), 7U);
+}
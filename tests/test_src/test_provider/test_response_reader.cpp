@@ -0,0 +1,168 @@
+#include "gtest/gtest.h"
+
+#include "provider/apiresponse.h"
+#include "provider/response_reader.h"
+
+namespace
+{
+std::string const bech32 = "erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th";
+
+std::string response(std::string const &data)
+{
+    return R"({"data":)" + data + R"(,"error":"","code":"successful"})";
+}
+
+// Message of the exception thrown by func, or an empty string if none
+template<typename Func>
+std::string errorOf(Func const &func)
+{
+    try
+    {
+        func();
+    }
+    catch (std::exception const &e)
+    {
+        return e.what();
+    }
+    return "";
+}
+
+// Same field extraction as ProxyProvider did before, through ErdGenericApiResponse and the json tree
+std::map<std::string, BigUInt> domAllESDTBalances(std::string const &body)
+{
+    ErdGenericApiResponse response(body);
+    response.checkSuccessfulOperation();
+    auto data = response.getData<nlohmann::json>();
+    utility::requireAttribute(data, "esdts");
+
+    std::map<std::string, BigUInt> ret;
+    for (auto const &it: data["esdts"].items())
+    {
+        utility::requireAttribute(it.value(), "balance");
+        std::string const balance = it.value()["balance"];
+        ret.emplace(it.key(), BigUInt(balance));
+    }
+    return ret;
+}
+}
+
+TEST(ResponseReader, readAccount)
+{
+    std::string const body = response(R"({"account":{"address":")" + bech32 + R"(","nonce":7,"balance":"1000000000000000000000",)"
+                                      R"("username":"","code":"","codeHash":null,"rootHash":"AAA=","developerReward":"0"}})");
+
+    Account const account = internal::readAccount(body, Address(bech32));
+
+    EXPECT_EQ(account.getAddress().getBech32Address(), bech32);
+    EXPECT_EQ(account.getNonce(), 7U);
+    EXPECT_EQ(account.getBalance(), BigUInt("1000000000000000000000"));
+}
+
+TEST(ResponseReader, readAccount_nestedKeysDoNotMatch)
+{
+    // "nonce" and "balance" are only accepted directly inside "account"
+    std::string const body = response(R"({"account":{"extra":{"nonce":1,"balance":"2"}},"nonce":3,"balance":"4"})");
+
+    EXPECT_EQ(errorOf([&]() { internal::readAccount(body, Address(bech32)); }), ERROR_MSG_JSON_KEY_NOT_FOUND + "balance");
+}
+
+TEST(ResponseReader, readNetworkConfig)
+{
+    std::string const body = response(R"({"config":{"erd_chain_id":"D","erd_denomination":18,"erd_gas_per_data_byte":1500,)"
+                                      R"("erd_min_gas_limit":50000,"erd_min_gas_price":1000000000,"erd_round_duration":6000}})");
+
+    NetworkConfig const cfg = internal::readNetworkConfig(body);
+
+    EXPECT_EQ(cfg.chainId, "D");
+    EXPECT_EQ(cfg.gasPerDataByte, 1500U);
+    EXPECT_EQ(cfg.minGasLimit, 50000U);
+    EXPECT_EQ(cfg.minGasPrice, 1000000000U);
+}
+
+TEST(ResponseReader, readNetworkConfig_missingField)
+{
+    std::string const body = response(R"({"config":{"erd_chain_id":"D","erd_gas_per_data_byte":1500,"erd_min_gas_price":1000000000}})");
+
+    EXPECT_EQ(errorOf([&]() { internal::readNetworkConfig(body); }), ERROR_MSG_JSON_KEY_NOT_FOUND + "erd_min_gas_limit");
+}
+
+TEST(ResponseReader, readESDTBalance)
+{
+    std::string const body = response(R"({"tokenData":{"balance":"123456789","properties":"","tokenIdentifier":"ALC-6258d2"}})");
+
+    EXPECT_EQ(internal::readESDTBalance(body), BigUInt("123456789"));
+}
+
+TEST(ResponseReader, readAllESDTBalances_sameAsJsonTree)
+{
+    std::string const body = response(R"({"esdts":{"ALC-6258d2":{"balance":"1","attributes":["a",{"b":2}]},)"
+                                      R"("MEX-455c57":{"tokenIdentifier":"MEX-455c57","balance":"99999999999999999999999"},)"
+                                      R"("WEGLD-bd4d79":{"balance":"0","properties":{"balance":"5"}}}})");
+
+    std::map<std::string, BigUInt> const balances = internal::readAllESDTBalances(body);
+
+    EXPECT_EQ(balances.size(), 3U);
+    EXPECT_EQ(balances.at("WEGLD-bd4d79"), BigUInt("0"));
+    EXPECT_EQ(balances, domAllESDTBalances(body));
+}
+
+TEST(ResponseReader, readAllESDTBalances_emptyAndMissingBalance)
+{
+    EXPECT_TRUE(internal::readAllESDTBalances(response(R"({"esdts":{}})")).empty());
+
+    std::string const body = response(R"({"esdts":{"ALC-6258d2":{"balance":"1"},"MEX-455c57":{"nonce":2}}})");
+    EXPECT_EQ(errorOf([&]() { internal::readAllESDTBalances(body); }), ERROR_MSG_JSON_KEY_NOT_FOUND + "balance");
+    EXPECT_EQ(errorOf([&]() { internal::readAllESDTBalances(body); }), errorOf([&]() { domAllESDTBalances(body); }));
+}
+
+TEST(ResponseReader, readTxHashAndStatus)
+{
+    EXPECT_EQ(internal::readTxHash(response(R"({"txHash":"abcd"})")), "abcd");
+    EXPECT_EQ(internal::readTransactionStatus(response(R"({"status":"success"})")).isSuccessful(), true);
+    EXPECT_EQ(errorOf([&]() { internal::readTxHash(response(R"({"hash":"abcd"})")); }), ERROR_MSG_JSON_KEY_NOT_FOUND + "txHash");
+}
+
+TEST(ResponseReader, readTxsHashes)
+{
+    std::string const body = response(R"({"numOfSentTxs":2,"txsHashes":{"0":"aa","2":"cc","7":"ignored"}})");
+
+    std::vector<std::string> const hashes = internal::readTxsHashes(body, 3);
+
+    EXPECT_EQ(hashes, (std::vector<std::string>{"aa", "", "cc"}));
+    EXPECT_EQ(errorOf([&]() { internal::readTxsHashes(response(R"({"numOfSentTxs":0})"), 1); }),
+              ERROR_MSG_JSON_KEY_NOT_FOUND + "txsHashes");
+}
+
+TEST(ResponseReader, envelopeErrors_sameAsApiResponse)
+{
+    std::vector<std::string> const bodies = {
+            R"(Invalid json)",
+            R"({"data":{"txHash":"abcd"},"code":"successful")",
+            R"({"data":{"txHash":"abcd"},"error":""})",
+            R"({"data":{"txHash":"abcd"},"code":"fail","error":"some error"})",
+            R"({"data":null,"code":"success","error":"some error"})",
+            R"({"data":null,"code":"", "error":""})",
+            R"({"error":"","code":"successful"})"};
+
+    for (std::string const &body: bodies)
+    {
+        std::string const expected = errorOf([&]()
+        {
+            ErdGenericApiResponse apiResponse(body);
+            apiResponse.checkSuccessfulOperation();
+            apiResponse.getData<nlohmann::json>();
+        });
+
+        EXPECT_FALSE(expected.empty()) << body;
+        EXPECT_EQ(errorOf([&]() { internal::readTxHash(body); }), expected) << body;
+    }
+}
+
+TEST(ResponseReader, envelopeAfterData)
+{
+    // "code" and "error" are only known once the whole body is read
+    std::string const body = R"({"data":{"txHash":"abcd"},"code":"internal_issue","error":"node is syncing"})";
+
+    EXPECT_EQ(errorOf([&]() { internal::readTxHash(body); }),
+              ERROR_MSG_HTTP_REQUEST_FAILED + "internal_issue. " + ERROR_MSG_REASON + "node is syncing");
+}
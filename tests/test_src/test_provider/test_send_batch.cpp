@@ -0,0 +1,129 @@
+#include "gtest/gtest.h"
+
+#include "provider/proxyprovider.h"
+#include "utils/errors.h"
+#include "json/json.hpp"
+#include "mock_proxy.h"
+
+#include <mutex>
+#include <vector>
+
+namespace
+{
+std::vector<Transaction> createTransactions(std::size_t const count)
+{
+    std::vector<Transaction> transactions(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Transaction &tx = transactions[i];
+        tx.m_nonce = i;
+        tx.m_sender = std::make_shared<Address>("erd1qyu5wthldzr8wx5c9ucg8kjagg0jfs53s8nr3zpz3hypefsdd8ssycr6th");
+        tx.m_receiver = std::make_shared<Address>("erd1sjsk3n2d0krq3pyxxtgf0q7j3t56sgusqaujj4n82l39t9h7jers6gslr4");
+        tx.m_gasPrice = 1000000000;
+        tx.m_gasLimit = 50000;
+        tx.m_chainID = "T";
+        tx.m_signature = std::make_shared<std::string>("signature");
+    }
+    return transactions;
+}
+
+// Accepts every transaction whose nonce is not a multiple of 7, like the proxy does with the valid ones of a batch
+class SendMultipleFixture : public ::testing::Test
+{
+public:
+    SendMultipleFixture()
+    {
+        m_mock.server().Post("/transaction/send-multiple", [this](httplib::Request const &req, httplib::Response &res)
+        {
+            nlohmann::json const transactions = nlohmann::json::parse(req.body);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_batchSizes.push_back(transactions.size());
+            }
+
+            nlohmann::json txsHashes = nlohmann::json::object();
+            for (std::size_t i = 0; i < transactions.size(); ++i)
+            {
+                uint64_t const nonce = transactions[i]["nonce"];
+                if (nonce % 7 != 0)
+                {
+                    txsHashes[std::to_string(i)] = "hash" + std::to_string(nonce);
+                }
+            }
+
+            nlohmann::json data;
+            data["numOfSentTxs"] = txsHashes.size();
+            data["txsHashes"] = txsHashes;
+            res.set_content(MockProxy::successResponse(data.dump()), "application/json");
+        });
+    }
+
+    MockProxy m_mock;
+    std::mutex m_mutex;
+    std::vector<std::size_t> m_batchSizes;
+};
+}
+
+TEST_F(SendMultipleFixture, sendBatch_splitsIntoBatches)
+{
+    ProxyProviderConfig config;
+    config.sendBatchSize = 40;
+    ProxyProvider proxy(m_mock.url(), config);
+
+    std::vector<Transaction> const transactions = createTransactions(100);
+    std::vector<TransactionSendResult> const results = proxy.sendBatch(transactions);
+
+    EXPECT_EQ(m_batchSizes, std::vector<std::size_t>({40, 40, 20}));
+    ASSERT_EQ(results.size(), transactions.size());
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        if (i % 7 == 0)
+        {
+            EXPECT_FALSE(results[i].sent);
+            EXPECT_EQ(results[i].error, ERROR_MSG_TX_NOT_ACCEPTED);
+        }
+        else
+        {
+            EXPECT_TRUE(results[i].sent);
+            EXPECT_EQ(results[i].txHash, "hash" + std::to_string(i));
+            EXPECT_TRUE(results[i].error.empty());
+        }
+    }
+}
+
+TEST_F(SendMultipleFixture, sendBatch_invalidTransactionLeftOut)
+{
+    ProxyProvider proxy(m_mock.url());
+
+    std::vector<Transaction> transactions = createTransactions(3);
+    transactions[1].m_receiver = nullptr;
+    std::vector<TransactionSendResult> const results = proxy.sendBatch(transactions);
+
+    EXPECT_EQ(m_batchSizes, std::vector<std::size_t>({2}));
+    ASSERT_EQ(results.size(), 3U);
+    EXPECT_FALSE(results[0].sent);
+    EXPECT_FALSE(results[1].sent);
+    EXPECT_EQ(results[1].error, ERROR_MSG_RECEIVER);
+    EXPECT_TRUE(results[2].sent);
+    EXPECT_EQ(results[2].txHash, "hash2");
+}
+
+TEST(ProxyProvider, sendBatch_failedRequest)
+{
+    MockProxy mock;
+    mock.server().Post("/transaction/send-multiple", [](httplib::Request const &, httplib::Response &res)
+    {
+        res.set_content(R"({"data":null,"error":"bad request","code":"bad_request"})", "application/json");
+    });
+    ProxyProvider proxy(mock.url());
+
+    std::vector<TransactionSendResult> const results = proxy.sendBatch(createTransactions(5));
+
+    ASSERT_EQ(results.size(), 5U);
+    for (auto const &result: results)
+    {
+        EXPECT_FALSE(result.sent);
+        EXPECT_NE(result.error.find("bad request"), std::string::npos);
+    }
+    EXPECT_TRUE(proxy.sendBatch({}).empty());
+}
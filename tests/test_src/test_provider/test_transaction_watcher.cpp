@@ -0,0 +1,177 @@
+#include "gtest/gtest.h"
+
+#include "provider/transaction_watcher.h"
+#include "mock_proxy.h"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+namespace
+{
+// Serves "pending" for the first polls of each hash, then the status encoded in the hash prefix
+// ("success-..." or "fail-..."). Hashes starting with "pending-" never complete, "unknown-" ones are never found and
+// "invalid-" ones are rejected as bad requests.
+class TransactionWatcherFixture : public ::testing::Test
+{
+public:
+    TransactionWatcherFixture()
+    {
+        m_mock.server().Get(R"(/transaction/([\w-]+)/status)", [this](httplib::Request const &req, httplib::Response &res)
+        {
+            std::string const txHash = req.matches[1];
+            int numPolls;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                numPolls = ++m_numPolls[txHash];
+            }
+
+            std::string const finalStatus = txHash.substr(0, txHash.find('-'));
+            if (finalStatus == "unknown")
+            {
+                res.set_content(R"({"data":null,"error":"transaction not found","code":"internal_issue"})", "application/json");
+                return;
+            }
+            if (finalStatus == "invalid")
+            {
+                res.status = 400;
+                res.set_content(R"({"data":null,"error":"invalid hash","code":"bad_request"})", "application/json");
+                return;
+            }
+
+            std::string const status = (numPolls <= 3 || finalStatus == "pending") ? "pending" : finalStatus;
+            res.set_content(MockProxy::successResponse(R"({"status":")" + status + R"("})"), "application/json");
+        });
+
+        m_config.initialInterval = std::chrono::milliseconds(2);
+        m_config.maxInterval = std::chrono::milliseconds(10);
+        m_config.timeout = std::chrono::seconds(30);
+    }
+
+    int numPolls(std::string const &txHash)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_numPolls[txHash];
+    }
+
+    MockProxy m_mock;
+    TransactionWatcherConfig m_config;
+    std::mutex m_mutex;
+    std::map<std::string, int> m_numPolls;
+};
+}
+
+TEST_F(TransactionWatcherFixture, watch_manyHashes)
+{
+    TransactionWatcher watcher(m_mock.url(), ProxyProviderConfig(), m_config);
+
+    std::vector<std::future<TransactionStatus>> futures;
+    for (int i = 0; i < 500; ++i)
+    {
+        futures.push_back(watcher.watch(((i % 5 == 0) ? "fail-" : "success-") + std::to_string(i)));
+    }
+
+    for (std::size_t i = 0; i < futures.size(); ++i)
+    {
+        TransactionStatus const status = futures[i].get();
+        EXPECT_EQ(status.isFailed(), i % 5 == 0);
+        EXPECT_EQ(status.isSuccessful(), i % 5 != 0);
+    }
+
+    EXPECT_EQ(watcher.numWatched(), 0U);
+    EXPECT_EQ(numPolls("success-1"), 4);
+    EXPECT_EQ(numPolls("fail-0"), 4);
+}
+
+TEST_F(TransactionWatcherFixture, watch_sameHashPolledOnce)
+{
+    TransactionWatcher watcher(m_mock.url(), ProxyProviderConfig(), m_config);
+
+    std::atomic<int> numCallbacks(0);
+    std::future<TransactionStatus> first = watcher.watch("success-a");
+    watcher.watch("success-a", [&](TransactionStatus const &status) { if (status.isSuccessful()) ++numCallbacks; }, nullptr);
+    std::future<TransactionStatus> second = watcher.watch("success-a");
+    EXPECT_EQ(watcher.numWatched(), 1U);
+
+    EXPECT_TRUE(first.get().isSuccessful());
+    EXPECT_TRUE(second.get().isSuccessful());
+    EXPECT_EQ(numCallbacks, 1);
+    EXPECT_EQ(numPolls("success-a"), 4);
+}
+
+TEST_F(TransactionWatcherFixture, watch_timeout)
+{
+    m_config.timeout = std::chrono::milliseconds(50);
+    TransactionWatcher watcher(m_mock.url(), ProxyProviderConfig(), m_config);
+
+    std::future<TransactionStatus> pending = watcher.watch("pending-a");
+    std::future<TransactionStatus> unknown = watcher.watch("unknown-a");
+
+    EXPECT_THROW(pending.get(), std::runtime_error);
+    try
+    {
+        unknown.get();
+        FAIL();
+    }
+    catch (std::runtime_error const &e)
+    {
+        // The timeout reports why the hash could not be followed
+        EXPECT_NE(std::string(e.what()).find("transaction not found"), std::string::npos);
+    }
+
+    // Backoff keeps the number of polls well below one per initial interval
+    EXPECT_LT(numPolls("pending-a"), 15);
+    EXPECT_GT(numPolls("unknown-a"), 1);
+}
+
+TEST_F(TransactionWatcherFixture, destructor_failsPendingWatches)
+{
+    std::future<TransactionStatus> pending;
+    {
+        TransactionWatcher watcher(m_mock.url(), ProxyProviderConfig(), m_config);
+        pending = watcher.watch("pending-a");
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    EXPECT_THROW(pending.get(), std::runtime_error);
+}
+
+TEST_F(TransactionWatcherFixture, watch_badRequestNotRetried)
+{
+    TransactionWatcher watcher(m_mock.url(), ProxyProviderConfig(), m_config);
+
+    try
+    {
+        watcher.watch("invalid-a").get();
+        FAIL();
+    }
+    catch (std::runtime_error const &e)
+    {
+        EXPECT_NE(std::string(e.what()).find("invalid hash"), std::string::npos);
+    }
+    EXPECT_EQ(numPolls("invalid-a"), 1);
+}
+
+TEST_F(TransactionWatcherFixture, watch_throwingCallbackDoesNotStopOthers)
+{
+    TransactionWatcher watcher(m_mock.url(), ProxyProviderConfig(), m_config);
+
+    std::promise<std::string> firstError;
+    watcher.watch("success-a",
+                  [](TransactionStatus const &) { throw std::runtime_error("callback failed"); },
+                  [&firstError](std::exception_ptr error)
+                  {
+                      try
+                      {
+                          std::rethrow_exception(error);
+                      }
+                      catch (std::exception const &e)
+                      {
+                          firstError.set_value(e.what());
+                      }
+                  });
+    std::future<TransactionStatus> second = watcher.watch("success-a");
+
+    EXPECT_EQ(firstError.get_future().get(), "callback failed");
+    EXPECT_TRUE(second.get().isSuccessful());
+}
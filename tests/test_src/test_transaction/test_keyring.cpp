@@ -0,0 +1,157 @@
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+#include "test_common.h"
+#include "utils/hex.h"
+#include "utils/errors.h"
+#include "transaction/keyring.h"
+#include "filehandler/pembundle.h"
+
+namespace
+{
+std::string const receiver = "erd1cux02zersde0l7hhklzhywcxk4u9n4py5tdxyx7vrvhnza2r4gmq4vw35r";
+
+bytes seedOf(std::size_t const i)
+{
+    bytes seed(SEED_LENGTH, 0);
+    std::memcpy(seed.data(), &i, sizeof(i));
+    return seed;
+}
+
+Transaction createTransaction(Address const &sender, uint64_t const nonce)
+{
+    Transaction tx;
+    tx.m_nonce = nonce;
+    tx.m_value = BigUInt(nonce * 1000);
+    tx.m_sender = std::make_shared<Address>(sender);
+    tx.m_receiver = std::make_shared<Address>(receiver);
+    tx.m_gasPrice = 1000000000;
+    tx.m_gasLimit = 50000;
+    tx.m_version = 2;
+    tx.m_options = (nonce % 2 == 0) ? std::make_shared<uint32_t>(1U) : DEFAULT_OPTIONS;
+    return tx;
+}
+}
+
+TEST(KeyRing, addAndFind)
+{
+    KeyRing keyRing;
+    std::vector<Signer> signers;
+
+    // Enough keys for the table to grow several times
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(keyRing.add(seedOf(i)));
+        signers.emplace_back(seedOf(i));
+    }
+    EXPECT_FALSE(keyRing.add(seedOf(7)));
+    EXPECT_EQ(keyRing.size(), 1000U);
+
+    for (Signer const &signer: signers)
+    {
+        Signer const *const found = keyRing.find(signer.getAddress());
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->getAddress(), signer.getAddress());
+    }
+
+    EXPECT_EQ(keyRing.find(Signer(seedOf(1000)).getAddress()), nullptr);
+    EXPECT_FALSE(keyRing.contains(Address(Address::PublicKey{})));
+    EXPECT_THROW(keyRing.add(bytes(SEED_LENGTH + 1, 0)), std::length_error);
+}
+
+TEST(KeyRing, addPemBundle)
+{
+    PemBundle const bundle(getCanonicalTestDataPath("keysBundle.pem"));
+
+    KeyRing keyRing;
+    // The last key of the bundle is a duplicate of the first one
+    EXPECT_EQ(keyRing.add(bundle), bundle.size() - 1);
+    EXPECT_EQ(keyRing.add(bundle), 0U);
+
+    for (std::size_t i = 0; i < bundle.size(); ++i)
+    {
+        EXPECT_TRUE(keyRing.contains(bundle.getAddress(i)));
+    }
+}
+
+TEST(KeyRing, sign_sameAsSigner)
+{
+    KeyRing keyRing;
+    keyRing.add(seedOf(1));
+    keyRing.add(seedOf(2));
+
+    Signer const signer(seedOf(2));
+    Transaction expected = createTransaction(signer.getAddress(), 3);
+    expected.sign(signer);
+
+    Transaction tx = createTransaction(signer.getAddress(), 3);
+    keyRing.sign(tx);
+    EXPECT_EQ(tx, expected);
+
+    Transaction unknown = createTransaction(Signer(seedOf(3)).getAddress(), 3);
+    EXPECT_THROW(keyRing.sign(unknown), std::invalid_argument);
+    EXPECT_EQ(unknown.m_signature, nullptr);
+
+    unknown.m_sender = nullptr;
+    EXPECT_THROW(keyRing.sign(unknown), std::invalid_argument);
+}
+
+TEST(KeyRing, signBatch_mixedSenders)
+{
+    std::size_t const numSenders = 5;
+    KeyRing keyRing;
+    std::vector<Signer> signers;
+    for (std::size_t i = 0; i < numSenders; ++i)
+    {
+        keyRing.add(seedOf(i));
+        signers.emplace_back(seedOf(i));
+    }
+    Address const unknownSender = Signer(seedOf(numSenders)).getAddress();
+
+    std::vector<Transaction> expected;
+    std::vector<bool> expectedSigned;
+    for (std::size_t i = 0; i < 23; ++i)
+    {
+        bool const known = (i % 7 != 6);
+        expected.push_back(createTransaction(known ? signers[i % numSenders].getAddress() : unknownSender, i));
+        if (known)
+        {
+            expected.back().sign(signers[i % numSenders]);
+        }
+        expectedSigned.push_back(known);
+    }
+
+    for (unsigned int numThreads : {0U, 1U, 3U, 64U})
+    {
+        std::vector<Transaction> transactions;
+        for (Transaction const &tx: expected)
+        {
+            transactions.push_back(createTransaction(*tx.m_sender, tx.m_nonce));
+        }
+
+        EXPECT_EQ(keyRing.signBatch(transactions, numThreads), expectedSigned);
+        for (std::size_t i = 0; i < transactions.size(); ++i)
+        {
+            EXPECT_EQ(transactions[i], expected[i]);
+        }
+        EXPECT_EQ(Transaction::verifyBatch(transactions, numThreads), expectedSigned);
+    }
+}
+
+TEST(KeyRing, signBatch_emptyAndInvalid)
+{
+    KeyRing keyRing;
+    keyRing.add(seedOf(1));
+    Address const sender = Signer(seedOf(1)).getAddress();
+
+    std::vector<Transaction> transactions;
+    EXPECT_TRUE(keyRing.signBatch(transactions, 4).empty());
+
+    transactions = {createTransaction(sender, 0), createTransaction(sender, 1)};
+    transactions[0].m_sender = nullptr;
+    EXPECT_EQ(keyRing.signBatch(transactions), (std::vector<bool>{false, true}));
+
+    transactions[1].m_receiver = nullptr;
+    EXPECT_THROW(keyRing.signBatch(transactions), std::invalid_argument);
+}
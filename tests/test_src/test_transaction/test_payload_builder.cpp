@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 #include "transaction/payload_builder.h"
 
+#include <functional>
+
 ContractCall generateSCCall()
 {
     SCArguments args;
@@ -108,3 +110,42 @@ TEST(ESDTIssuePayloadBuilder, build)
     payload = builder.withProperties(esdtProperties).build();
     EXPECT_EQ(payload, "issue@416c696365546f6b656e73@414c43@f3d7b4c0@06@63616e467265657a65@66616c7365@63616e57697065@66616c7365@63616e5061757365@66616c7365@63616e4d696e74@74727565@63616e4275726e@74727565@63616e4368616e67654f776e6572@66616c7365@63616e55706772616465@66616c7365@63616e4164645370656369616c526f6c6573@66616c7365@63616e5472616e736665724e4654437265617465526f6c65@66616c7365");
 }
+
+TEST(PayloadBuilders, buildIntoBuffer_sameAsString)
+{
+    ContractCall const contractCall = generateSCCall();
+    std::vector<TokenPayment> const payments = {
+            TokenPayment::semiFungible("SEMI-9efd0f", 1, BigUInt(5)),
+            TokenPayment::fungibleFromAmount("RIDE-7d18e9", "1634.132360763445665862", 18)};
+    Address const destination("erd1testnlersh4z0wsv8kjx39me4rmnvjkwu8dsaea7ukdvvc9z396qykv7z7");
+
+    auto const expectAppended = [](std::string const &expected, std::function<void(bytes &)> const &build)
+    {
+        bytes payload = {'x'};
+        build(payload);
+        EXPECT_EQ(std::string(payload.begin(), payload.end()), "x" + expected);
+    };
+
+    auto const esdt = ESDTTransferPayloadBuilder().setPayment(payments[1]).withContractCall(contractCall);
+    expectAppended(esdt.build(), [&](bytes &out) { esdt.build(out); });
+
+    auto nft = ESDTNFTTransferPayloadBuilder();
+    nft.setPayment(payments[0]).setDestination(destination).withContractCall(contractCall);
+    expectAppended(nft.build(), [&](bytes &out) { nft.build(out); });
+
+    auto multi = MultiESDTNFTTransferPayloadBuilder();
+    multi.setPayments(payments).setDestination(destination).withContractCall(contractCall);
+    expectAppended(multi.build(), [&](bytes &out) { multi.build(out); });
+
+    ESDTProperties properties;
+    properties.canMint = true;
+    auto issue = ESDTIssuePayloadBuilder("AliceTokens");
+    issue.setTicker("ALC").setInitialSupply(BigUInt(4091000000)).setNumOfDecimals(6).withProperties(properties);
+    expectAppended(issue.build(), [&](bytes &out) { issue.build(out); });
+
+    bytes onData;
+    contractCall.appendOnData(onData);
+    EXPECT_EQ(std::string(onData.begin(), onData.end()), contractCall.asOnData());
+    ContractCall("").appendOnData(onData);
+    EXPECT_EQ(std::string(onData.begin(), onData.end()), contractCall.asOnData());
+}
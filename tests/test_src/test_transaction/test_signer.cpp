@@ -47,6 +47,10 @@ TEST(Signer, getSignature)
     std::string expectedSignature = "b5fddb8c16fa7f6123cb32edc854f1e760a3eb62c6dc420b5a4c0473c58befd45b621b31a448c5b59e21428f2bc128c80d0ee1caa4f2bf05a12be857ad451b00";
 
     EXPECT_EQ(util::stringToHex(signature), expectedSignature);
+
+    uint8_t rawSignature[SIGNATURE_LENGTH];
+    signer.sign(msg, rawSignature);
+    EXPECT_EQ(std::string(rawSignature, rawSignature + SIGNATURE_LENGTH), signature);
 }
 
 TEST(Signer, verify_signature_by_signer)
@@ -58,6 +62,20 @@ TEST(Signer, verify_signature_by_signer)
     std::string signature = util::hexToString("b5fddb8c16fa7f6123cb32edc854f1e760a3eb62c6dc420b5a4c0473c58befd45b621b31a448c5b59e21428f2bc128c80d0ee1caa4f2bf05a12be857ad451b00");
 
     EXPECT_TRUE(signer.verify(signature, msg));
+    EXPECT_FALSE(signer.verify(signature.substr(1), msg));
+    EXPECT_FALSE(signer.verify("", msg));
+}
+
+TEST(Signer, getAddress)
+{
+    bytes const seed = util::hexToBytes("1a927e2af5306a9bb2ea777f73e06ecc0ac9aaa72fb4ea3fecf659451394cccf");
+    Signer const signer(seed);
+    Signer const signerCopy(signer);
+
+    EXPECT_EQ(signer.getAddress().getBech32Address(), "erd1l453hd0gt5gzdp7czpuall8ggt2dcv5zwmfdf3sd3lguxseux2fsmsgldz");
+    EXPECT_EQ(signer.getAddress().getPublicKey(), wrapper::crypto::getPublicKey(wrapper::crypto::getSecretKey(seed)));
+    EXPECT_EQ(signerCopy.getAddress().getBech32Address(), signer.getAddress().getBech32Address());
+    EXPECT_EQ(signerCopy.getSignature("message"), signer.getSignature("message"));
 }
 
 TEST(Signer, verify_signature_by_publicKey)
@@ -81,3 +99,37 @@ TEST(Signer, verify_signature_by_address)
 
     EXPECT_TRUE(Signer::verify(signature, msg, signerAddr));
 }
+
+TEST(Signer, verifyBatch)
+{
+    bytes const seed = util::hexToBytes("1a927e2af5306a9bb2ea777f73e06ecc0ac9aaa72fb4ea3fecf659451394cccf");
+    Signer signer(seed);
+    bytes const publicKey = wrapper::crypto::getPublicKey(wrapper::crypto::getSecretKey(seed));
+    bytes const otherPublicKey = Address("erd1cux02zersde0l7hhklzhywcxk4u9n4py5tdxyx7vrvhnza2r4gmq4vw35r").getPublicKey();
+
+    std::vector<SignedMessage> signedMessages;
+    std::vector<bool> expectedResults;
+    for (int i = 0; i < 20; ++i)
+    {
+        std::string const message = "message " + std::to_string(i);
+        SignedMessage signedMessage{signer.getSignature(message), message, publicKey};
+
+        switch (i % 5)
+        {
+            case 1: signedMessage.message += "tampered"; break;
+            case 2: signedMessage.publicKey = otherPublicKey; break;
+            case 3: signedMessage.signature.pop_back(); break;
+            case 4: signedMessage.publicKey.push_back(0); break;
+            default: break;
+        }
+
+        signedMessages.push_back(signedMessage);
+        expectedResults.push_back(i % 5 == 0);
+    }
+
+    for (unsigned int numThreads : {0U, 1U, 3U, 32U})
+    {
+        EXPECT_EQ(Signer::verifyBatch(signedMessages, numThreads), expectedResults);
+    }
+    EXPECT_TRUE(Signer::verifyBatch({}).empty());
+}
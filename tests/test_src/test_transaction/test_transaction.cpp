@@ -2,6 +2,8 @@
 
 #include "utils/hex.h"
 #include "utils/errors.h"
+#include "utils/params.h"
+#include "wrappers/jsonwrapper.h"
 #include "transaction/transaction.h"
 
 // Most tests for signing and transaction construction are adapted from one of the following sources:
@@ -10,6 +12,36 @@
 // - MX-SDK-PY-CLI: https://github.com/multiversx/mx-sdk-py-cli/blob/main/multiversx_sdk_cli/tests/test_wallet.py
 // - MX-CHAIN-GO:   https://github.com/multiversx/mx-chain-go/blob/master/examples/construction_test.go
 
+// Reference serialization through the generic ordered json wrapper. The dedicated transaction
+// serializer should always produce byte-identical output.
+template<typename T>
+void setJsonValueIfNotNull(wrapper::json::OrderedJson &json, std::string const &key, Optional<T> const &val)
+{
+    if (val != nullptr)
+        json.set(key, *val);
+}
+
+std::string serializeWithOrderedJson(Transaction const &tx)
+{
+    wrapper::json::OrderedJson json;
+
+    json.set(TX_NONCE, tx.m_nonce);
+    json.set(TX_VALUE, tx.m_value.getValue());
+    json.set(TX_RECEIVER, tx.m_receiver->getBech32Address());
+    json.set(TX_SENDER, tx.m_sender->getBech32Address());
+    setJsonValueIfNotNull(json, TX_RECEIVER_NAME, tx.m_receiverUserName);
+    setJsonValueIfNotNull(json, TX_SENDER_NAME, tx.m_senderUserName);
+    json.set(TX_GAS_PRICE, tx.m_gasPrice);
+    json.set(TX_GAS_LIMIT, tx.m_gasLimit);
+    setJsonValueIfNotNull(json, TX_DATA, tx.m_data);
+    setJsonValueIfNotNull(json, TX_SIGNATURE, tx.m_signature);
+    json.set(TX_CHAIN_ID, tx.m_chainID);
+    json.set(TX_VERSION, tx.m_version);
+    setJsonValueIfNotNull(json, TX_OPTIONS, tx.m_options);
+
+    return json.serialize();
+}
+
 struct signSerializedTxData
 {
     std::string signerSeed;
@@ -162,10 +194,13 @@ TEST_P(TransactionSignSerializeParametrized, getSignature_serialize)
 
     EXPECT_EQ(transaction.serialize(), currParam.expectedSerialized);
 
+    EXPECT_EQ(transaction.serialize(), serializeWithOrderedJson(transaction));
+
     signTransaction(transaction, currParam.signerSeed);
 
     EXPECT_EQ((*transaction.m_signature), currParam.expectedSignature);
     EXPECT_TRUE(transaction.verify());
+    EXPECT_EQ(transaction.serialize(), serializeWithOrderedJson(transaction));
 }
 
 struct deserializedTxData
@@ -189,7 +224,7 @@ struct deserializedTxData
 class TransactionDeserializeParametrized : public ::testing::TestWithParam<deserializedTxData>
 {
 public:
-    static void EXPECT_PTR_BYTE_EQ_STR(std::shared_ptr<bytes> const &txData, std::string const &paramData)
+    static void EXPECT_PTR_BYTE_EQ_STR(Optional<bytes> const &txData, std::string const &paramData)
     {
         if (paramData.empty())
         {
@@ -202,7 +237,7 @@ public:
     }
 
     template <class T>
-    void EXPECT_PTR_EQ(std::shared_ptr<T> const &txData, std::shared_ptr<T>const &paramData)
+    void EXPECT_PTR_EQ(Optional<T> const &txData, std::shared_ptr<T>const &paramData)
     {
         if (paramData == nullptr)
         {
@@ -322,6 +357,17 @@ TEST_P(TransactionDeserializeParametrized, deserialize)
     EXPECT_PTR_EQ(transaction.m_options,  currParam.options);
 }
 
+TEST_P(TransactionDeserializeParametrized, deserialize_serialize_sameAsOrderedJson)
+{
+    deserializedTxData const& currParam = GetParam();
+
+    Transaction transaction;
+    transaction.deserialize(currParam.serializedTx);
+
+    EXPECT_EQ(transaction.serialize(), currParam.serializedTx);
+    EXPECT_EQ(transaction.serialize(), serializeWithOrderedJson(transaction));
+}
+
 struct invalidSerializedTxData
 {
     std::string serializedTx;
@@ -437,6 +483,63 @@ TEST_F(TransactionSerializeFixture, serialize_missingFields)
     expectSerializeException<std::invalid_argument>(tx, ERROR_MSG_RECEIVER);
 }
 
+TEST_F(TransactionSerializeFixture, serialize_escapedStrings_sameAsOrderedJson)
+{
+    Transaction tx;
+    tx.m_sender = std::make_shared<Address>("erd10536tc3s886yqxtln74u6mztuwl5gy9k9gp8fttxda0klgxg979srtg5wt");
+    tx.m_receiver = std::make_shared<Address>("erd1sjsk3n2d0krq3pyxxtgf0q7j3t56sgusqaujj4n82l39t9h7jers6gslr4");
+    tx.m_data = std::make_shared<bytes>(util::hexToBytes("00ff10"));
+    tx.m_gasLimit = UINT64_MAX;
+
+    std::vector<std::string> const values = {
+            "",
+            "quote\"backslash\\slash/",
+            std::string("\b\t\n\f\r\x01\x1f\x7f", 8),
+            std::string("nul\0char", 8),
+            "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80"};
+
+    for (auto const &value: values)
+    {
+        tx.m_chainID = value;
+        tx.m_signature = std::make_shared<std::string>(value);
+
+        EXPECT_EQ(tx.serialize(), serializeWithOrderedJson(tx));
+    }
+
+    std::vector<std::string> const invalidUTF8 = {
+            "\xc3",
+            "\xc0\xaf",
+            "\xed\xa0\x80",
+            "\xf4\x90\x80\x80",
+            "\xe2\x82"};
+
+    for (auto const &value: invalidUTF8)
+    {
+        tx.m_chainID = value;
+        tx.m_signature = nullptr;
+
+        EXPECT_THROW(serializeWithOrderedJson(tx), std::exception);
+        expectSerializeException<std::invalid_argument>(tx, ERROR_MSG_JSON_INVALID_UTF8 + TX_CHAIN_ID);
+    }
+}
+
+TEST_F(TransactionSerializeFixture, serialize_reusedBuffer)
+{
+    Transaction tx;
+    tx.m_sender = std::make_shared<Address>("erd10536tc3s886yqxtln74u6mztuwl5gy9k9gp8fttxda0klgxg979srtg5wt");
+    tx.m_receiver = std::make_shared<Address>("erd1sjsk3n2d0krq3pyxxtgf0q7j3t56sgusqaujj4n82l39t9h7jers6gslr4");
+
+    std::string buffer = "previous content";
+    for (uint64_t nonce = 0; nonce < 3; ++nonce)
+    {
+        tx.m_nonce = nonce;
+        tx.serialize(buffer);
+
+        EXPECT_EQ(buffer, tx.serialize());
+        EXPECT_EQ(buffer, serializeWithOrderedJson(tx));
+    }
+}
+
 TEST(Transaction, comparisonOperator)
 {
     Transaction tx1;
@@ -536,3 +639,81 @@ TEST(Transaction, comparisonOperator)
 
     EXPECT_EQ(tx1.serialize(), tx2.serialize());
 }
+
+class TransactionSignBatchFixture : public ::testing::Test
+{
+public:
+    static std::vector<Transaction> createTransactions(std::size_t const count)
+    {
+        std::vector<Transaction> transactions;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Transaction tx;
+            tx.m_nonce = i;
+            tx.m_value = BigUInt(i * 1000);
+            tx.m_sender = std::make_shared<Address>("erd1l453hd0gt5gzdp7czpuall8ggt2dcv5zwmfdf3sd3lguxseux2fsmsgldz");
+            tx.m_receiver = std::make_shared<Address>("erd1cux02zersde0l7hhklzhywcxk4u9n4py5tdxyx7vrvhnza2r4gmq4vw35r");
+            tx.m_gasPrice = 1000000000;
+            tx.m_gasLimit = 50000;
+            tx.m_version = 2;
+            tx.m_options = (i % 2 == 0) ? std::make_shared<uint32_t>(1U) : DEFAULT_OPTIONS;
+            transactions.push_back(tx);
+        }
+
+        return transactions;
+    }
+
+    Signer const signer = Signer(util::hexToBytes("1a927e2af5306a9bb2ea777f73e06ecc0ac9aaa72fb4ea3fecf659451394cccf"));
+};
+
+TEST_F(TransactionSignBatchFixture, signBatch_sameAsSign)
+{
+    std::vector<Transaction> expected = createTransactions(17);
+    for (auto &tx: expected)
+    {
+        tx.sign(signer);
+    }
+
+    for (unsigned int numThreads : {0U, 1U, 2U, 3U, 16U, 64U})
+    {
+        std::vector<Transaction> transactions = createTransactions(expected.size());
+        Transaction::signBatch(transactions, signer, numThreads);
+
+        ASSERT_EQ(transactions.size(), expected.size());
+        for (std::size_t i = 0; i < transactions.size(); ++i)
+        {
+            EXPECT_EQ(transactions[i], expected[i]);
+            EXPECT_TRUE(transactions[i].verify());
+        }
+    }
+}
+
+TEST_F(TransactionSignBatchFixture, signBatch_emptyAndInvalid)
+{
+    std::vector<Transaction> transactions;
+    EXPECT_NO_THROW(Transaction::signBatch(transactions, signer, 4));
+
+    transactions = createTransactions(8);
+    transactions[5].m_receiver = nullptr;
+    EXPECT_THROW(Transaction::signBatch(transactions, signer, 4), std::invalid_argument);
+}
+
+TEST_F(TransactionSignBatchFixture, verifyBatch)
+{
+    std::vector<Transaction> transactions = createTransactions(12);
+    Transaction::signBatch(transactions, signer);
+
+    transactions[1].m_nonce += 1;
+    transactions[3].m_signature = nullptr;
+    transactions[5].m_sender = std::make_shared<Address>("erd1cux02zersde0l7hhklzhywcxk4u9n4py5tdxyx7vrvhnza2r4gmq4vw35r");
+    transactions[7].m_signature = std::make_shared<std::string>("not hex");
+    transactions[9].m_signature->replace(0, 2, "zz");
+    transactions[11].m_receiver = nullptr;
+
+    std::vector<bool> const expected = {true, false, true, false, true, false, true, false, true, false, true, false};
+    for (unsigned int numThreads : {0U, 1U, 4U, 64U})
+    {
+        EXPECT_EQ(Transaction::verifyBatch(transactions, numThreads), expected);
+    }
+}
@@ -296,3 +296,108 @@ TEST(TransactionFactory, createESDTIssue)
     EXPECT_EQ(tx, createTransaction(5, BigUInt(ESDT_ISSUANCE_VALUE), sender, expectedReceiver, gasPrice, 60000000, "issue@416c696365@414c43@03e8@0a@63616e467265657a65@66616c7365@63616e57697065@66616c7365@63616e5061757365@66616c7365@63616e4d696e74@66616c7365@63616e4275726e@66616c7365@63616e4368616e67654f776e6572@74727565@63616e55706772616465@66616c7365@63616e4164645370656369616c526f6c6573@74727565@63616e5472616e736665724e4654437265617465526f6c65@66616c7365", "eb689a5831471b476468ab2598053cde9c7ebb690e1dfe3d6fa87de2f387bee87828dcee3f8acc67d090ba35a16397a5a958e4114eb546f20c52d5728cb0b500", cfg.chainId, 6, 7));
     EXPECT_TRUE(tx.verify());
 }
+
+TEST(TransactionFactory, createESDTTransferTemplate_sameAsCreateESDTTransfer)
+{
+    PemFileReader pem(getCanonicalTestDataPath("alicePem.pem"));
+    Address sender = pem.getAddress();
+    Address receiver("erd1qqqqqqqqqqqqqpgqrc4pg2xarca9z34njcxeur622qmfjp8w2jps89fxnl");
+    uint64_t gasPrice = 99999;
+
+    NetworkConfig cfg = DEFAULT_MAINNET_NETWORK_CONFIG;
+    TransactionFactory txFactory(cfg);
+    ESDTTransferTemplate txTemplate = txFactory.createESDTTransferTemplate("ERDCPP-38f249", sender, gasPrice);
+
+    SCArguments args;
+    args.add("boo");
+    ContractCall contractCall("foo", args);
+
+    for (BigUInt const &amount: {BigUInt(0), BigUInt(1), BigUInt("1000000000000000000"), BigUInt("123456789012345678901234567890")})
+    {
+        TokenPayment const payment = TokenPayment::fungibleFromBigUInt("ERDCPP-38f249", amount);
+
+        Transaction tx = txTemplate.build(7, receiver, amount);
+        EXPECT_EQ(tx, txFactory.createESDTTransfer(payment, 7, sender, receiver, gasPrice)->build());
+
+        ESDTTransferTemplate customized = txTemplate;
+        customized.withContractCall(contractCall).withVersion(2).withOptions(1);
+        tx = customized.build(8, receiver, amount);
+        EXPECT_EQ(tx, txFactory.createESDTTransfer(payment, 8, sender, receiver, gasPrice)
+                ->withContractCall(contractCall)
+                .withVersion(2)
+                .withOptions(1)
+                .build());
+    }
+
+    Transaction tx = txTemplate.build(1, receiver, BigUInt(1));
+    EXPECT_EQ(tx, createTransaction(1, DEFAULT_VALUE, sender, receiver, gasPrice, 413000, "ESDTTransfer@4552444350502d333866323439@01", "", cfg.chainId, DEFAULT_VERSION, NO_OPTION));
+}
+
+TEST(TransactionFactory, createESDTTransferTemplate_buildBatchesIntoSameVector)
+{
+    PemFileReader pem(getCanonicalTestDataPath("alicePem.pem"));
+    Address sender = pem.getAddress();
+    Address receiver1("erd1qqqqqqqqqqqqqpgqrc4pg2xarca9z34njcxeur622qmfjp8w2jps89fxnl");
+    Address receiver2("erd1cux02zersde0l7hhklzhywcxk4u9n4py5tdxyx7vrvhnza2r4gmq4vw35r");
+
+    NetworkConfig cfg = DEFAULT_MAINNET_NETWORK_CONFIG;
+    TransactionFactory txFactory(cfg);
+    ESDTTransferTemplate const txTemplate = txFactory.createESDTTransferTemplate("ERDCPP-38f249", sender, 1000000000);
+
+    std::vector<Transaction> transactions;
+    txTemplate.build({{1, receiver1, BigUInt(10)}, {2, receiver2, BigUInt("1000000000000000000")}, {3, receiver1, BigUInt(0)}}, transactions);
+    ASSERT_EQ(transactions.size(), 3U);
+    transactions[0].sign(Signer(pem.getSeed()));
+
+    // A copy kept from a previous batch is not affected by the next one
+    Transaction const kept = transactions[1];
+    std::string const keptData = kept.serialize();
+
+    std::vector<ESDTTransferTarget> const targets = {{4, receiver2, BigUInt(5)}, {5, receiver2, BigUInt(6)}};
+    txTemplate.build(targets, transactions);
+    ASSERT_EQ(transactions.size(), 2U);
+
+    for (std::size_t i = 0; i < targets.size(); ++i)
+    {
+        EXPECT_EQ(transactions[i], txTemplate.build(targets[i].nonce, targets[i].receiver, targets[i].amount));
+        EXPECT_EQ(transactions[i].m_signature, nullptr);
+    }
+    EXPECT_EQ(kept.serialize(), keptData);
+}
+
+TEST(TransactionFactory, buildIntoTransaction_sameAsBuilders)
+{
+    PemFileReader pem(getCanonicalTestDataPath("alicePem.pem"));
+    Address sender = pem.getAddress();
+    Address receiver("erd1qqqqqqqqqqqqqpgqrc4pg2xarca9z34njcxeur622qmfjp8w2jps89fxnl");
+    uint64_t gasPrice = 99999;
+
+    NetworkConfig cfg = DEFAULT_MAINNET_NETWORK_CONFIG;
+    TransactionFactory txFactory(cfg);
+    TokenPayment token = TokenPayment::fungibleFromAmount("ERDCPP-38f249", "12.5", 2);
+    TokenPayment nft = TokenPayment::nonFungible("ERDCPP-38f249", 4);
+
+    // Every field of the transaction is overwritten, including the ones the built transactions do not set
+    Transaction tx = txFactory.createEGLDTransfer(1, BigUInt(1), receiver, sender, 1, "data")->withVersion(2).withOptions(1).buildSigned(pem.getSeed());
+    tx.m_receiverUserName = bytes{'a'};
+    tx.m_senderUserName = bytes{'b'};
+
+    txFactory.buildEGLDTransfer(tx, 1, BigUInt(10), sender, receiver, gasPrice, "foo");
+    EXPECT_EQ(tx, txFactory.createEGLDTransfer(1, BigUInt(10), sender, receiver, gasPrice, "foo")->build());
+
+    txFactory.buildEGLDTransfer(tx, 2, BigUInt(10), sender, receiver, gasPrice);
+    EXPECT_EQ(tx, txFactory.createEGLDTransfer(2, BigUInt(10), sender, receiver, gasPrice)->build());
+    EXPECT_EQ(tx.m_data, nullptr);
+
+    txFactory.buildESDTTransfer(tx, token, 3, sender, receiver, gasPrice);
+    EXPECT_EQ(tx, txFactory.createESDTTransfer(token, 3, sender, receiver, gasPrice)->build());
+
+    txFactory.buildESDTNFTTransfer(tx, nft, 4, sender, receiver, gasPrice);
+    EXPECT_EQ(tx, txFactory.createESDTNFTTransfer(nft, 4, sender, receiver, gasPrice)->build());
+
+    txFactory.buildMultiESDTNFTTransfer(tx, {token, nft}, 5, sender, receiver, gasPrice);
+    EXPECT_EQ(tx, txFactory.createMultiESDTNFTTransfer({token, nft}, 5, sender, receiver, gasPrice)->build());
+
+    tx.sign(Signer(pem.getSeed()));
+    EXPECT_TRUE(tx.verify());
+}
@@ -2,6 +2,63 @@
 
 #include "internal/internal.h"
 #include "ext.h"
+#include "thread_pool.h"
+#include "rate_limiter.h"
+#include "backoff.h"
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <random>
+
+namespace
+{
+char const BASE64_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Bit by bit implementation util::base64 used to have, kept as a reference
+std::string legacyBase64Encode(std::string const &in)
+{
+    std::string out;
+    unsigned int val = 0;
+    int valb = -6;
+    for (uchar c : in)
+    {
+        val = ((val << 8) + c) & 0xFFFFFF;
+        valb += 8;
+        while (valb >= 0)
+        {
+            out.push_back(BASE64_ALPHABET[(val >> valb) & 0x3F]);
+            valb -= 6;
+        }
+    }
+    if (valb > -6)
+        out.push_back(BASE64_ALPHABET[((val << 8) >> (valb + 8)) & 0x3F]);
+    while (out.size() % 4) out.push_back('=');
+    return out;
+}
+
+std::string legacyBase64Decode(std::string const &in)
+{
+    std::string out;
+    std::vector<int> T(256, -1);
+    for (int i = 0; i < 64; i++) T[uchar(BASE64_ALPHABET[i])] = i;
+
+    unsigned int val = 0;
+    int valb = -8;
+    for (uchar c : in)
+    {
+        if (T[c] == -1) break;
+        val = ((val << 6) + unsigned(T[c])) & 0xFFFFFF;
+        valb += 6;
+        if (valb >= 0)
+        {
+            out.push_back(char((val >> valb) & 0xFF));
+            valb -= 8;
+        }
+    }
+    return out;
+}
+}
 
 TEST(Base64, decode)
 {
@@ -21,6 +78,65 @@ TEST(Base64, encode)
     EXPECT_EQ(expectedEncoded, encodedBase64Txt);
 }
 
+TEST(Base64, sameAsLegacy_randomBytes)
+{
+    std::mt19937 rng(7);
+
+    for (std::size_t size = 0; size < 600; ++size)
+    {
+        std::string data(size, '\0');
+        for (char &c : data)
+        {
+            c = char(rng() & 0xFF);
+        }
+
+        std::string const encoded = util::base64::encode(data);
+        EXPECT_EQ(encoded, legacyBase64Encode(data));
+        EXPECT_EQ(encoded.size(), util::base64::encodedLength(size));
+        EXPECT_EQ(util::base64::decode(encoded), legacyBase64Decode(encoded));
+        EXPECT_EQ(util::base64::decode(encoded), data);
+    }
+}
+
+TEST(Base64, sameAsLegacy_malformedInput)
+{
+    std::mt19937 rng(11);
+    std::string const extraChars = "=-_ \n.\x80\xff";
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        std::string input(rng() % 40, '\0');
+        for (char &c : input)
+        {
+            // Mostly alphabet characters, with padding, whitespace and invalid bytes mixed in
+            c = (rng() % 8 == 0) ? extraChars[rng() % extraChars.size()] : BASE64_ALPHABET[rng() % 64];
+        }
+
+        std::string const expected = legacyBase64Decode(input);
+        EXPECT_EQ(util::base64::decode(input), expected) << input;
+        EXPECT_EQ(util::base64::decodedLength(input.data(), input.size()), expected.size()) << input;
+    }
+}
+
+TEST(Base64, intoBuffer)
+{
+    std::string const text = "Man is distinguished";
+    std::string const expectedEncoded = "TWFuIGlzIGRpc3Rpbmd1aXNoZWQ=";
+    auto const data = reinterpret_cast<unsigned char const *>(text.data());
+
+    std::string encoded(util::base64::encodedLength(text.size()), '\0');
+    util::base64::encode(data, text.size(), &encoded[0]);
+    EXPECT_EQ(encoded, expectedEncoded);
+
+    std::string appended = "prefix:";
+    util::base64::encode(data, text.size(), appended);
+    EXPECT_EQ(appended, "prefix:" + expectedEncoded);
+
+    bytes decoded(util::base64::decodedLength(encoded.data(), encoded.size()));
+    EXPECT_EQ(util::base64::decode(encoded.data(), encoded.size(), decoded.data()), text.size());
+    EXPECT_EQ(decoded, bytes(text.begin(), text.end()));
+}
+
 TEST(Hex, toBytes)
 {
     std::string textHex = "0A11f4C";
@@ -36,8 +152,168 @@ TEST(Hex, toBytes)
     EXPECT_EQ(computedBytes, expectedBytes);
 }
 
+TEST(Hex, toBytes_invalidDigit)
+{
+    // Long enough to go through both the 32 digit blocks and the byte by byte tail
+    std::string const validHex = "000102030405060708090a0b0c0d0e0f101112131415161718191A1B1C1D1E1F2021";
+    ASSERT_NO_THROW(util::hexToBytes(validHex));
+
+    for (std::size_t i = 0; i < validHex.size(); ++i)
+    {
+        for (char const invalid : {'g', 'G', ' ', '/', ':', '@', '`', char(0xB0)})
+        {
+            std::string hex = validHex;
+            hex[i] = invalid;
+            EXPECT_THROW({ util::hexToBytes(hex); }, std::invalid_argument) << hex;
+            if (hex.size() % 2 == 0)
+            {
+                EXPECT_THROW({ util::hexToString(hex); }, std::invalid_argument) << hex;
+            }
+        }
+    }
+}
+
+TEST(Hex, roundTrip)
+{
+    std::mt19937 rng(3);
+    char const *digits = "0123456789abcdef";
+
+    for (std::size_t size = 0; size < 100; ++size)
+    {
+        std::string data(size, '\0');
+        std::string expectedHex;
+        for (char &c : data)
+        {
+            c = char(rng() & 0xFF);
+            expectedHex.push_back(digits[uchar(c) >> 4]);
+            expectedHex.push_back(digits[uchar(c) & 15]);
+        }
+
+        std::string const hex = util::stringToHex(data);
+        EXPECT_EQ(hex, expectedHex);
+        EXPECT_EQ(util::hexToString(hex), data);
+
+        std::string upperHex = hex;
+        for (char &c : upperHex)
+        {
+            c = char(toupper(c));
+        }
+        EXPECT_EQ(util::hexToBytes(upperHex), bytes(data.begin(), data.end()));
+    }
+}
+
+TEST(Hex, intoBuffer)
+{
+    uint8_t const data[] = {0x00, 0xff, 0x10, 0xab};
+    char hex[2 * sizeof(data)];
+    util::bytesToHex(data, sizeof(data), hex);
+    EXPECT_EQ(std::string(hex, sizeof(hex)), "00ff10ab");
+
+    uint8_t decoded[3];
+    EXPECT_EQ(util::hexToBytes("00ff1", 5, decoded), 3U);
+    EXPECT_EQ(bytes(decoded, decoded + 3), bytes({0x00, 0xff, 0x01}));
+}
+
 TEST(String, toHex)
 {
     std::string str = "Hello World";
     EXPECT_EQ(util::stringToHex(str), "48656c6c6f20576f726c64");
 }
+
+TEST(ThreadPool, submit_blocksWhenFull)
+{
+    std::promise<void> release;
+    std::shared_future<void> const released = release.get_future().share();
+    std::atomic<int> numDone(0);
+
+    std::unique_ptr<util::ThreadPool> pool(new util::ThreadPool(2, 3));
+    for (int i = 0; i < 3; ++i)
+    {
+        pool->submit([&]() { released.wait(); ++numDone; });
+    }
+    EXPECT_EQ(pool->numPending(), 3U);
+
+    std::atomic<bool> submitted(false);
+    std::thread producer([&]()
+                         {
+                             pool->submit([&]() { ++numDone; });
+                             submitted = true;
+                         });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(submitted);
+
+    release.set_value();
+    producer.join();
+    EXPECT_TRUE(submitted);
+
+    pool.reset();
+    EXPECT_EQ(numDone, 4);
+}
+
+TEST(ThreadPool, submit_fromWorkerDoesNotBlock)
+{
+    std::atomic<int> numDone(0);
+    {
+        util::ThreadPool pool(1, 1);
+        pool.submit([&]()
+                    {
+                        for (int i = 0; i < 10; ++i)
+                        {
+                            pool.submit([&]() { ++numDone; });
+                        }
+                        throw std::runtime_error("discarded");
+                    });
+    }
+    EXPECT_EQ(numDone, 10);
+}
+
+TEST(RateLimiter, reserve_burstThenRate)
+{
+    util::RateLimiter limiter(100, 3);
+
+    auto const start = util::RateLimiter::Clock::now();
+    std::vector<util::RateLimiter::Clock::time_point> slots;
+    for (int i = 0; i < 6; ++i)
+    {
+        slots.push_back(limiter.reserve());
+    }
+
+    // The burst starts at once, the following slots are 10ms apart
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_LT(slots[i] - start, std::chrono::milliseconds(5));
+    }
+    for (int i = 3; i < 6; ++i)
+    {
+        EXPECT_GE(slots[i] - start, std::chrono::milliseconds(10 * (i - 2)));
+        EXPECT_LT(slots[i] - start, std::chrono::milliseconds(10 * (i - 2) + 5));
+    }
+}
+
+TEST(RateLimiter, reserve_unlimited)
+{
+    util::RateLimiter limiter(0, 1);
+
+    auto const start = util::RateLimiter::Clock::now();
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_LT(limiter.reserve() - start, std::chrono::milliseconds(100));
+    }
+}
+
+TEST(Backoff, delay_growsUpToMax)
+{
+    util::Backoff const backoff(std::chrono::milliseconds(100), std::chrono::milliseconds(1000));
+    std::mt19937 rng(42);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_GE(backoff.delay(0, rng), std::chrono::milliseconds(50));
+        EXPECT_LE(backoff.delay(0, rng), std::chrono::milliseconds(100));
+        EXPECT_GE(backoff.delay(2, rng), std::chrono::milliseconds(200));
+        EXPECT_LE(backoff.delay(2, rng), std::chrono::milliseconds(400));
+        EXPECT_GE(backoff.delay(100, rng), std::chrono::milliseconds(500));
+        EXPECT_LE(backoff.delay(100, rng), std::chrono::milliseconds(1000));
+    }
+}
@@ -0,0 +1,227 @@
+#include "gtest/gtest.h"
+
+#include "wrappers/httpresilience.h"
+#include "mock_proxy.h"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+wrapper::http::Timeouts const TIMEOUTS{std::chrono::seconds(1), std::chrono::seconds(1), std::chrono::seconds(1)};
+
+wrapper::http::ResiliencePolicy policy(unsigned int const maxRetries, unsigned int const failureThreshold)
+{
+    return wrapper::http::ResiliencePolicy{maxRetries, std::chrono::milliseconds(1), std::chrono::milliseconds(2),
+                                           std::chrono::milliseconds(0), failureThreshold, std::chrono::milliseconds(100)};
+}
+
+// Answers GET /status with status, or 200 once healthy
+class StatusProxy
+{
+public:
+    explicit StatusProxy(int const status) :
+            m_status(status)
+    {
+        m_mock.server().Get("/status", [this](httplib::Request const &, httplib::Response &res)
+        {
+            res.status = m_status;
+            res.set_content(MockProxy::successResponse("{}"), "application/json");
+        });
+        m_mock.server().Post("/status", [this](httplib::Request const &, httplib::Response &res)
+        {
+            res.status = m_status;
+            res.set_content(MockProxy::successResponse("{}"), "application/json");
+        });
+    }
+
+    void setStatus(int const status)
+    {
+        m_status = status;
+    }
+
+    MockProxy &mock()
+    {
+        return m_mock;
+    }
+
+private:
+    MockProxy m_mock;
+    std::atomic<int> m_status;
+};
+
+// Url of a port nothing listens on
+std::string closedPortUrl()
+{
+    httplib::Server server;
+    int const port = server.bind_to_any_port("127.0.0.1");
+    return "http://127.0.0.1:" + std::to_string(port);
+}
+}
+
+TEST(ResilientClient, get_retriesTransientFailures)
+{
+    std::atomic<int> numRequests(0);
+    MockProxy mock;
+    mock.server().Get("/status", [&](httplib::Request const &, httplib::Response &res)
+    {
+        res.status = (++numRequests <= 2) ? 503 : 200;
+    });
+
+    wrapper::http::ResilientClient client({mock.url()}, 2, std::chrono::seconds(30), TIMEOUTS, policy(3, 0));
+    wrapper::http::Result const result = client.get("/status");
+
+    EXPECT_EQ(result.status, 200);
+    EXPECT_EQ(numRequests, 3);
+    EXPECT_EQ(client.numRetries(), 2U);
+}
+
+TEST(ResilientClient, get_givesUpAfterMaxRetries)
+{
+    StatusProxy proxy(429);
+
+    wrapper::http::ResilientClient client({proxy.mock().url()}, 2, std::chrono::seconds(30), TIMEOUTS, policy(2, 0));
+    wrapper::http::Result const result = client.get("/status");
+
+    EXPECT_EQ(result.status, 429);
+    EXPECT_EQ(proxy.mock().numRequests(), 3U);
+}
+
+TEST(ResilientClient, noRetryOfProxyErrorsAndPosts)
+{
+    // Proxies answer invalid requests with 500
+    StatusProxy invalid(500);
+    wrapper::http::ResilientClient client({invalid.mock().url()}, 2, std::chrono::seconds(30), TIMEOUTS, policy(3, 0));
+
+    EXPECT_EQ(client.get("/status").status, 500);
+    EXPECT_EQ(invalid.mock().numRequests(), 1U);
+
+    StatusProxy unavailable(503);
+    wrapper::http::ResilientClient postClient({unavailable.mock().url()}, 2, std::chrono::seconds(30), TIMEOUTS, policy(3, 0));
+
+    EXPECT_EQ(postClient.post("/status", "{}").status, 503);
+    EXPECT_EQ(unavailable.mock().numRequests(), 1U);
+}
+
+TEST(ResilientClient, noResponse)
+{
+    wrapper::http::ResilientClient client({closedPortUrl()}, 2, std::chrono::seconds(30), TIMEOUTS, policy(1, 0));
+    wrapper::http::Result const result = client.get("/status");
+
+    EXPECT_TRUE(result.error);
+    EXPECT_EQ(result.statusMessage.find(ERROR_MSG_HTTP_NO_RESPONSE), 0U);
+    EXPECT_EQ(client.numRetries(), 1U);
+}
+
+TEST(ResilientClient, failover_circuitBreaker)
+{
+    StatusProxy primary(503);
+    StatusProxy fallback(200);
+
+    wrapper::http::ResilientClient client({primary.mock().url(), fallback.mock().url()}, 2, std::chrono::seconds(30), TIMEOUTS, policy(1, 3));
+
+    // Each request fails on the primary, then its retry succeeds on the fallback
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(client.get("/status").status, 200);
+    }
+    EXPECT_EQ(primary.mock().numRequests(), 3U);
+    EXPECT_TRUE(client.isOpen(0));
+
+    // The open primary is skipped, transactions go to the fallback too
+    EXPECT_EQ(client.get("/status").status, 200);
+    EXPECT_EQ(client.post("/status", "{}").status, 200);
+    EXPECT_EQ(primary.mock().numRequests(), 3U);
+    EXPECT_EQ(fallback.mock().numRequests(), 5U);
+
+    // Once openDuration elapsed, a probe finds the primary healthy again
+    primary.setStatus(200);
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    EXPECT_EQ(client.get("/status").status, 200);
+    EXPECT_FALSE(client.isOpen(0));
+    EXPECT_EQ(primary.mock().numRequests(), 4U);
+}
+
+TEST(ResilientClient, failover_failedProbeReopens)
+{
+    StatusProxy primary(503);
+
+    wrapper::http::ResilientClient client({primary.mock().url()}, 2, std::chrono::seconds(30), TIMEOUTS, policy(0, 1));
+
+    EXPECT_EQ(client.get("/status").status, 503);
+    EXPECT_TRUE(client.isOpen(0));
+
+    wrapper::http::Result const refused = client.get("/status");
+    EXPECT_TRUE(refused.error);
+    EXPECT_EQ(refused.statusMessage, ERROR_MSG_HTTP_NO_ENDPOINT_AVAILABLE);
+    EXPECT_EQ(primary.mock().numRequests(), 1U);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    EXPECT_EQ(client.get("/status").status, 503);
+    EXPECT_TRUE(client.get("/status").error);
+    EXPECT_EQ(primary.mock().numRequests(), 2U);
+}
+
+TEST(ResilientClient, deadline)
+{
+    MockProxy slow;
+    slow.server().Get("/status", [](httplib::Request const &, httplib::Response &res)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        res.status = 200;
+    });
+
+    wrapper::http::ResiliencePolicy deadlinePolicy = policy(5, 0);
+    deadlinePolicy.deadline = std::chrono::milliseconds(100);
+    wrapper::http::ResilientClient client({slow.url()}, 2, std::chrono::seconds(30), TIMEOUTS, deadlinePolicy);
+
+    auto const start = std::chrono::steady_clock::now();
+    wrapper::http::Result const result = client.get("/status");
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(result.error);
+    EXPECT_LT(elapsed, std::chrono::milliseconds(400));
+}
+
+TEST(ClientPool, deadline_whilePoolIsFull)
+{
+    MockProxy slow;
+    slow.server().Get("/status", [](httplib::Request const &, httplib::Response &res)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        res.status = 200;
+    });
+
+    wrapper::http::ClientPool pool(slow.url(), 1, std::chrono::seconds(30), TIMEOUTS);
+
+    // The only client of the pool is taken by a slow request, the second one gives up waiting for it
+    std::thread busy([&pool]() { EXPECT_EQ(pool.get("/status").status, 200); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    auto const start = std::chrono::steady_clock::now();
+    wrapper::http::Result const result = pool.get("/status", TIMEOUTS, start + std::chrono::milliseconds(100));
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+    busy.join();
+
+    EXPECT_TRUE(result.error);
+    EXPECT_EQ(result.statusMessage, ERROR_MSG_HTTP_DEADLINE_EXCEEDED);
+    EXPECT_LT(elapsed, std::chrono::milliseconds(300));
+    EXPECT_EQ(slow.numRequests(), 1U);
+}
+
+TEST(CircuitBreaker, release_freesHalfOpenProbe)
+{
+    wrapper::http::CircuitBreaker breaker(1, std::chrono::milliseconds(10));
+
+    breaker.onFailure();
+    EXPECT_FALSE(breaker.tryAcquire());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_TRUE(breaker.tryAcquire());
+    EXPECT_FALSE(breaker.tryAcquire()); // A single probe at a time
+
+    // The probe never reached the endpoint, another one may go
+    breaker.release();
+    EXPECT_TRUE(breaker.isOpen());
+    EXPECT_TRUE(breaker.tryAcquire());
+}